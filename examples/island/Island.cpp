@@ -6,7 +6,6 @@
 #include "stb_perlin.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
-#include <deque>
 #include <sstream>
 #include <algorithm>
 #include <cstring>
@@ -33,12 +32,10 @@ namespace
         unsigned int index;
     };
 
-    std::deque<WorkItem> workQueue;
-    std::vector<sf::Thread*> threads;
+    sf::ThreadPool* threadPool = NULL;
     int pendingWorkCount = 0;
-    bool workPending = true;
     bool bufferUploadPending = false;
-    sf::Mutex workQueueMutex;
+    sf::Mutex workMutex;
 
     struct Setting
     {
@@ -67,7 +64,6 @@ namespace
 
 
 // Forward declarations of the functions we define further down
-void threadFunction();
 void generateTerrain(sf::Vertex* vertexBuffer);
 
 
@@ -79,6 +75,10 @@ void generateTerrain(sf::Vertex* vertexBuffer);
 ////////////////////////////////////////////////////////////
 int main()
 {
+    // Start up our thread pool
+    sf::ThreadPool pool(threadCount);
+    threadPool = &pool;
+
     // Create the window of the application
     sf::RenderWindow window(sf::VideoMode(windowWidth, windowHeight), "SFML Island",
                             sf::Style::Titlebar | sf::Style::Close);
@@ -128,13 +128,6 @@ int main()
     }
     else
     {
-        // Start up our thread pool
-        for (unsigned int i = 0; i < threadCount; i++)
-        {
-            threads.push_back(new sf::Thread(threadFunction));
-            threads.back()->launch();
-        }
-
         // Create our VertexBuffer with enough space to hold all the terrain geometry
         terrain.create(resolutionX * resolutionY * 6);
 
@@ -207,7 +200,7 @@ int main()
         if (prerequisitesSupported)
         {
             {
-                sf::Lock lock(workQueueMutex);
+                sf::Lock lock(workMutex);
 
                 // Don't bother updating/drawing the VertexBuffer while terrain is being regenerated
                 if (!pendingWorkCount)
@@ -242,18 +235,8 @@ int main()
         window.display();
     }
 
-    // Shut down our thread pool
-    {
-        sf::Lock lock(workQueueMutex);
-        workPending = false;
-    }
-
-    while (!threads.empty())
-    {
-        threads.back()->wait();
-        delete threads.back();
-        threads.pop_back();
-    }
+    // Let the running work items finish before the staging buffer is destroyed
+    pool.wait();
 
     return EXIT_SUCCESS;
 }
@@ -501,90 +484,48 @@ void processWorkItem(std::vector<sf::Vertex>& vertices, const WorkItem& workItem
 
 
 ////////////////////////////////////////////////////////////
-/// Worker thread entry point. We use a thread pool to avoid
-/// the heavy cost of constantly recreating and starting
-/// new threads whenever we need to regenerate the terrain.
+/// Work item entry point, run by the thread pool. We use a
+/// thread pool to avoid the heavy cost of constantly
+/// recreating and starting new threads whenever we need to
+/// regenerate the terrain.
 ///
 ////////////////////////////////////////////////////////////
-void threadFunction()
+void runWorkItem(WorkItem workItem)
 {
     unsigned int rowBlockSize = (resolutionY / blockCount) + 1;
 
     std::vector<sf::Vertex> vertices(resolutionX * rowBlockSize * 6);
 
-    WorkItem workItem = {0, 0};
+    processWorkItem(vertices, workItem);
 
-    // Loop until the application exits
-    for (;;)
-    {
-        workItem.targetBuffer = 0;
-
-        // Check if there are new work items in the queue
-        {
-            sf::Lock lock(workQueueMutex);
-
-            if (!workPending)
-                return;
-
-            if (!workQueue.empty())
-            {
-                workItem = workQueue.front();
-                workQueue.pop_front();
-            }
-        }
-
-        // If we didn't receive a new work item, keep looping
-        if (!workItem.targetBuffer)
-        {
-            sf::sleep(sf::milliseconds(10));
+    sf::Lock lock(workMutex);
 
-            continue;
-        }
-
-        processWorkItem(vertices, workItem);
-
-        {
-            sf::Lock lock(workQueueMutex);
-
-            --pendingWorkCount;
-        }
-    }
+    --pendingWorkCount;
 }
 
 
 ////////////////////////////////////////////////////////////
-/// Terrain generation entry point. This queues up the
-/// generation work items which the worker threads dequeue
-/// and process.
+/// Terrain generation entry point. This submits the
+/// generation work items to the thread pool.
 ///
 ////////////////////////////////////////////////////////////
 void generateTerrain(sf::Vertex* buffer)
 {
+    // Make sure the previous work items are done before queuing new work
+    threadPool->wait();
+
     bufferUploadPending = true;
 
-    // Make sure the work queue is empty before queuing new work
-    for (;;)
     {
-        {
-            sf::Lock lock(workQueueMutex);
+        sf::Lock lock(workMutex);
 
-            if (workQueue.empty())
-                break;
-        }
-
-        sf::sleep(sf::milliseconds(10));
+        pendingWorkCount = blockCount;
     }
 
-    // Queue all the new work items
+    // Submit all the new work items
+    for (unsigned int i = 0; i < blockCount; i++)
     {
-        sf::Lock lock(workQueueMutex);
-
-        for (unsigned int i = 0; i < blockCount; i++)
-        {
-            WorkItem workItem = {buffer, i};
-            workQueue.push_back(workItem);
-        }
-
-        pendingWorkCount = blockCount;
+        WorkItem workItem = {buffer, i};
+        threadPool->submit(&runWorkItem, workItem);
     }
 }
@@ -30,6 +30,8 @@ public:
     m_host(host),
     m_port(port)
     {
+        // Send small chunks often, to keep the voice latency low
+        setProcessingInterval(sf::milliseconds(10));
     }
 
     ////////////////////////////////////////////////////////////
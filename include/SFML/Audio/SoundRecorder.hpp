@@ -30,6 +30,8 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Export.hpp>
 #include <SFML/Audio/AlResource.hpp>
+#include <SFML/System/ConditionVariable.hpp>
+#include <SFML/System/Mutex.hpp>
 #include <SFML/System/Thread.hpp>
 #include <SFML/System/Time.hpp>
 #include <vector>
@@ -205,6 +207,13 @@ protected:
     ///
     /// Note: this is only a hint, the actual period may vary.
     /// So don't rely on this parameter to implement precise timing.
+    /// If you need to know when the samples of a chunk were
+    /// captured, use getCaptureOffset instead.
+    ///
+    /// Intervals of a few milliseconds are supported, which is
+    /// what low-latency applications such as voice chat need.
+    /// The actual latency is then bounded by the period at which
+    /// the audio driver delivers captured data.
     ///
     /// The default processing interval is 100 ms.
     ///
@@ -213,6 +222,23 @@ protected:
     ////////////////////////////////////////////////////////////
     void setProcessingInterval(Time interval);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the capture time of the current chunk
+    ///
+    /// The returned value is the position, in the recorded
+    /// stream, of the first sample of the chunk being processed.
+    /// It is measured from the start of the capture, and thus
+    /// doesn't depend on when onProcessSamples is actually called.
+    /// This function is meant to be called from onProcessSamples;
+    /// elsewhere, it returns the position of the next chunk.
+    ///
+    /// \return Capture time of the current chunk
+    ///
+    /// \see onProcessSamples
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getCaptureOffset() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Start capturing audio data
     ///
@@ -237,6 +263,11 @@ protected:
     /// \param samples     Pointer to the new chunk of recorded samples
     /// \param sampleCount Number of samples pointed by \a samples
     ///
+    /// The \a samples buffer is owned by the recorder and reused
+    /// for every chunk, so copy its contents if you need them
+    /// after this function returns. The capture time of the
+    /// chunk can be retrieved with getCaptureOffset.
+    ///
     /// \return True to continue the capture, or false to stop it
     ///
     ////////////////////////////////////////////////////////////
@@ -274,6 +305,27 @@ private:
     ////////////////////////////////////////////////////////////
     void processCapturedSamples();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute how long to wait for the next chunk
+    ///
+    /// The returned delay accounts for the samples that
+    /// are already waiting in the capture buffer, so that
+    /// the next chunk is processed as soon as a full
+    /// processing interval worth of samples is available.
+    ///
+    /// \return Time to wait before processing the next chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getTimeUntilNextChunk() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell the recording thread to stop and wake it up
+    ///
+    /// This function doesn't wait for the thread to finish.
+    ///
+    ////////////////////////////////////////////////////////////
+    void requestStop();
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up the recorder's internal resources
     ///
@@ -286,7 +338,10 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     Thread             m_thread;             ///< Thread running the background recording task
-    std::vector<Int16> m_samples;            ///< Buffer to store captured samples
+    Mutex              m_threadMutex;        ///< Mutex protecting the capturing state
+    ConditionVariable  m_threadCondition;    ///< Signaled when the recording thread must stop
+    std::vector<Int16> m_samples;            ///< Buffer to store captured samples, allocated once per capture
+    Uint64             m_processedFrames;    ///< Number of frames delivered since the capture started
     unsigned int       m_sampleRate;         ///< Sample rate
     Time               m_processingInterval; ///< Time period between calls to onProcessSamples
     bool               m_isCapturing;        ///< Capturing state
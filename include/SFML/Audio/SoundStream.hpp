@@ -33,6 +33,7 @@
 #include <SFML/System/Thread.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Mutex.hpp>
+#include <SFML/System/ConditionVariable.hpp>
 #include <cstdlib>
 
 
@@ -306,17 +307,18 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Thread        m_thread;                   ///< Thread running the background tasks
-    mutable Mutex m_threadMutex;              ///< Thread mutex
-    Status        m_threadStartState;         ///< State the thread starts in (Playing, Paused, Stopped)
-    bool          m_isStreaming;              ///< Streaming state (true = playing, false = stopped)
-    unsigned int  m_buffers[BufferCount];     ///< Sound buffers used to store temporary audio data
-    unsigned int  m_channelCount;             ///< Number of channels (1 = mono, 2 = stereo, ...)
-    unsigned int  m_sampleRate;               ///< Frequency (samples / second)
-    Uint32        m_format;                   ///< Format of the internal sound buffers
-    bool          m_loop;                     ///< Loop flag (true to loop, false to play once)
-    Uint64        m_samplesProcessed;         ///< Number of buffers processed since beginning of the stream
-    Int64         m_bufferSeeks[BufferCount]; ///< If buffer is an "end buffer", holds next seek position, else NoLoop. For play offset calculation.
+    Thread            m_thread;                   ///< Thread running the background tasks
+    mutable Mutex     m_threadMutex;              ///< Thread mutex
+    ConditionVariable m_threadCondition;          ///< Signaled when the streaming thread must wake up (stop, resume)
+    Status            m_threadStartState;         ///< State the thread starts in (Playing, Paused, Stopped)
+    bool              m_isStreaming;              ///< Streaming state (true = playing, false = stopped)
+    unsigned int      m_buffers[BufferCount];     ///< Sound buffers used to store temporary audio data
+    unsigned int      m_channelCount;             ///< Number of channels (1 = mono, 2 = stereo, ...)
+    unsigned int      m_sampleRate;               ///< Frequency (samples / second)
+    Uint32            m_format;                   ///< Format of the internal sound buffers
+    bool              m_loop;                     ///< Loop flag (true to loop, false to play once)
+    Uint64            m_samplesProcessed;         ///< Number of buffers processed since beginning of the stream
+    Int64             m_bufferSeeks[BufferCount]; ///< If buffer is an "end buffer", holds next seek position, else NoLoop. For play offset calculation.
 };
 
 } // namespace sf
@@ -38,6 +38,7 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Glyph.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageWriter.hpp>
 #include <SFML/Graphics/MyFont.hpp>
 #include <SFML/Graphics/MyGlyph.hpp>
 #include <SFML/Graphics/MyText.hpp>
@@ -47,12 +48,16 @@
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTexturePool.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Shape.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureAtlas.hpp>
+#include <SFML/Graphics/TextureReadback.hpp>
+#include <SFML/Graphics/TileMap.hpp>
 #include <SFML/Graphics/Transform.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/Vertex.hpp>
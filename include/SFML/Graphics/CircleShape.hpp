@@ -106,13 +106,23 @@ public:
     ////////////////////////////////////////////////////////////
     virtual Vector2f getPoint(std::size_t index) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the points of the circle
+    ///
+    /// \param points Array to fill, must be large enough to hold \a count points
+    /// \param count  Number of points to get, must be equal to getPointCount()
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void getPoints(Vector2f* points, std::size_t count) const;
+
 private:
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    float       m_radius;     ///< Radius of the circle
-    std::size_t m_pointCount; ///< Number of points composing the circle
+    float           m_radius;     ///< Radius of the circle
+    std::size_t     m_pointCount; ///< Number of points composing the circle
+    const Vector2f* m_unitPoints; ///< Points of the unit circle for the current point count, shared by all circles (NULL if not cached)
 };
 
 } // namespace sf
@@ -149,6 +159,10 @@ private:
 /// small numbers you can create any regular polygon shape:
 /// equilateral triangle, square, pentagon, hexagon, ...
 ///
+/// The points of a unit circle are computed once for each
+/// point count and shared by all the circles, so changing
+/// the radius of a circle is cheap.
+///
 /// \see sf::Shape, sf::RectangleShape, sf::ConvexShape
 ///
 ////////////////////////////////////////////////////////////
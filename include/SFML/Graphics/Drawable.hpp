@@ -30,6 +30,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Export.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Rect.hpp>
 
 
 namespace sf
@@ -67,8 +68,35 @@ protected:
     ///
     ////////////////////////////////////////////////////////////
     virtual void draw(RenderTarget& target, RenderStates states) const = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the object
+    ///
+    /// This function is called by the render target when culling
+    /// is enabled, to skip objects that are entirely outside of
+    /// the current view. The bounds are expressed in the same
+    /// coordinate system as the vertices sent by draw(), before
+    /// the transform of the render states is applied.
+    /// The default implementation returns false, which means that
+    /// the bounds are unknown and the object is always drawn.
+    ///
+    /// \param bounds Rectangle to fill with the bounds of the object
+    ///
+    /// \return True if \a bounds was filled, false if the object can't be culled
+    ///
+    /// \see RenderTarget::setCullingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool getCullingBounds(FloatRect& bounds) const;
 };
 
+
+////////////////////////////////////////////////////////////
+inline bool Drawable::getCullingBounds(FloatRect&) const
+{
+    return false;
+}
+
 } // namespace sf
 
 
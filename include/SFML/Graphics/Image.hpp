@@ -146,14 +146,40 @@ public:
     /// tga and jpg. The destination file is overwritten
     /// if it already exists. This function fails if the image is empty.
     ///
-    /// \param filename Path of the file to save
+    /// The compression level only applies to PNG files: it ranges
+    /// from 0 (no compression, fastest) to 9 (smallest files).
+    ///
+    /// \param filename         Path of the file to save
+    /// \param compressionLevel PNG compression level, in range [0, 9]
+    ///
+    /// \return True if saving was successful
+    ///
+    /// \see create, loadFromFile, loadFromMemory, saveToMemory, sf::ImageWriter
+    ///
+    ////////////////////////////////////////////////////////////
+    bool saveToFile(const std::string& filename, int compressionLevel = 6) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the image to a buffer in memory
+    ///
+    /// The format of the image must be specified.
+    /// The supported image formats are bmp, png, tga and jpg.
+    /// This function fails if the image is empty, or if
+    /// the format was invalid.
+    ///
+    /// The compression level only applies to the PNG format: it
+    /// ranges from 0 (no compression, fastest) to 9 (smallest data).
+    ///
+    /// \param output           Buffer to fill with encoded data
+    /// \param format           Encoding format to use
+    /// \param compressionLevel PNG compression level, in range [0, 9]
     ///
     /// \return True if saving was successful
     ///
-    /// \see create, loadFromFile, loadFromMemory
+    /// \see create, loadFromFile, loadFromMemory, saveToFile
     ///
     ////////////////////////////////////////////////////////////
-    bool saveToFile(const std::string& filename) const;
+    bool saveToMemory(std::vector<Uint8>& output, const std::string& format, int compressionLevel = 6) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Return the size (width and height) of the image
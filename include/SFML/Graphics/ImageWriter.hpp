@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_IMAGEWRITER_HPP
+#define SFML_IMAGEWRITER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Thread.hpp>
+#include <deque>
+#include <string>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Saves images to files in a background thread
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ImageWriter : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageWriter();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The destructor waits until all the queued images are saved.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ImageWriter();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue an image to be saved to a file on disk
+    ///
+    /// The image is copied, so it can be modified or destroyed
+    /// as soon as this function returns. Images are encoded and
+    /// written in the order they were queued, exactly like
+    /// Image::saveToFile would do.
+    ///
+    /// \param image            Image to save
+    /// \param filename         Path of the file to save
+    /// \param compressionLevel PNG compression level, in range [0, 9]
+    ///
+    /// \see wait, Image::saveToFile
+    ///
+    ////////////////////////////////////////////////////////////
+    void save(const Image& image, const std::string& filename, int compressionLevel = 6);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until all the queued images are saved
+    ///
+    /// \see save
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of images that could not be saved
+    ///
+    /// The reason of each failure is written to the SFML
+    /// error output.
+    ///
+    /// \return Number of failed saves since the writer was created
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getFailureCount() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function run by the worker thread
+    ///
+    ////////////////////////////////////////////////////////////
+    void run();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Image waiting to be saved
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Job
+    {
+        Image       image;            ///< Copy of the image to save
+        std::string filename;         ///< Path of the destination file
+        int         compressionLevel; ///< PNG compression level
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Thread           m_thread;       ///< Worker thread, running as long as there are queued images
+    mutable Mutex    m_mutex;        ///< Mutex protecting the queue and the worker state
+    std::deque<Job*> m_jobs;         ///< Images waiting to be saved
+    bool             m_working;      ///< Is the worker thread processing the queue?
+    std::size_t      m_failureCount; ///< Number of images that could not be saved
+};
+
+} // namespace sf
+
+
+#endif // SFML_IMAGEWRITER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ImageWriter
+/// \ingroup graphics
+///
+/// Encoding an image, especially to the PNG format, can take
+/// a significant amount of time. sf::ImageWriter moves this
+/// work (and the disk access) to a background thread, so that
+/// taking screenshots or thumbnails doesn't interrupt the
+/// caller.
+///
+/// The worker thread only runs while there are images in the
+/// queue. The functions of sf::ImageWriter must all be called
+/// from the same thread.
+///
+/// To encode an image to a buffer in memory instead of a
+/// file, use Image::saveToMemory.
+///
+/// Usage example:
+/// \code
+/// sf::ImageWriter writer;
+///
+/// // Queue the screenshots, the function returns immediately
+/// for (std::size_t i = 0; i < screenshots.size(); ++i)
+///     writer.save(screenshots[i], "shot" + toString(i) + ".png", 1);
+///
+/// // ...
+///
+/// // Make sure that everything is written before exiting
+/// writer.wait();
+/// \endcode
+///
+/// \see sf::Image
+///
+////////////////////////////////////////////////////////////
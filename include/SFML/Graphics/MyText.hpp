@@ -108,6 +108,29 @@ public:
     ////////////////////////////////////////////////////////////
     void setString(const String& string);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the text's string by swapping it with another one
+    ///
+    /// This function is equivalent to setString, except that
+    /// the new string is not copied: its contents are exchanged
+    /// with the current string of the text, which is returned
+    /// in \a string. Reusing the returned string to prepare the
+    /// next update avoids reallocating a buffer every time the
+    /// text changes.
+    /// \code
+    /// sf::String buffer;
+    /// ...
+    /// buffer = score;
+    /// text.swapString(buffer); // buffer now holds the previous string
+    /// \endcode
+    ///
+    /// \param string New string; receives the previous string of the text
+    ///
+    /// \see setString, getString
+    ///
+    ////////////////////////////////////////////////////////////
+    void swapString(String& string);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the text's font
     ///
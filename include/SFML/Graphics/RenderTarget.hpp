@@ -230,6 +230,9 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Draw a drawable object to the render target
     ///
+    /// If culling is enabled and the drawable provides its bounds,
+    /// it is skipped when it lies entirely outside of the current view.
+    ///
     /// \param drawable Object to draw
     /// \param states   Render states to use for drawing
     ///
@@ -268,6 +271,73 @@ public:
     ////////////////////////////////////////////////////////////
     void draw(const VertexBuffer& vertexBuffer, std::size_t firstVertex, std::size_t vertexCount, const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable view culling of drawables
+    ///
+    /// When culling is enabled, draw(const Drawable&, const RenderStates&)
+    /// tests the global bounds of the drawables that provide them
+    /// (sprites, shapes, texts and vertex arrays) against the
+    /// area covered by the current view, and doesn't draw the
+    /// ones that are entirely outside of it.
+    /// Culling is disabled by default. Don't enable it if you
+    /// use vertex shaders that move geometry outside of its
+    /// original bounds.
+    ///
+    /// \param enabled True to enable culling, false to disable it
+    ///
+    /// \see isCullingEnabled, getCulledCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCullingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether view culling of drawables is enabled
+    ///
+    /// \return True if culling is enabled, false otherwise
+    ///
+    /// \see setCullingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isCullingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of drawables that were drawn
+    ///
+    /// This counts the calls to draw(const Drawable&, const RenderStates&)
+    /// that were not culled since the last call to resetCullingCounters.
+    ///
+    /// \return Number of drawables drawn
+    ///
+    /// \see getCulledCount, resetCullingCounters
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getDrawnCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of drawables that were culled
+    ///
+    /// This counts the drawables that were skipped because they
+    /// were outside of the current view, since the last call to
+    /// resetCullingCounters.
+    ///
+    /// \return Number of drawables culled
+    ///
+    /// \see getDrawnCount, resetCullingCounters
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCulledCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the drawn and culled counters to zero
+    ///
+    /// This is typically called once per frame, for example
+    /// right after clear().
+    ///
+    /// \see getDrawnCount, getCulledCount
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetCullingCounters();
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -478,10 +548,13 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View        m_defaultView; ///< Default view
-    View        m_view;        ///< Current view
-    StatesCache m_cache;       ///< Render states cache
-    Uint64      m_id;          ///< Unique number that identifies the RenderTarget
+    View        m_defaultView;    ///< Default view
+    View        m_view;           ///< Current view
+    StatesCache m_cache;          ///< Render states cache
+    Uint64      m_id;             ///< Unique number that identifies the RenderTarget
+    bool        m_cullingEnabled; ///< Are drawables outside of the view skipped?
+    std::size_t m_drawnCount;     ///< Number of drawables drawn since the last reset
+    std::size_t m_culledCount;    ///< Number of drawables culled since the last reset
 };
 
 } // namespace sf
@@ -0,0 +1,243 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_RENDERTEXTUREPOOL_HPP
+#define SFML_RENDERTEXTUREPOOL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Window/ContextSettings.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <map>
+#include <vector>
+
+
+namespace sf
+{
+class RenderTexture;
+
+////////////////////////////////////////////////////////////
+/// \brief Pool of reusable render textures
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderTexturePool : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty pool.
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Destroys all the idle render textures of the pool.
+    /// Render textures that are currently acquired are not
+    /// affected: they are then owned by the caller, which must
+    /// destroy them with delete.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a render texture of the given size and settings
+    ///
+    /// If the pool contains an idle render texture which was
+    /// created with the same size and settings, it is returned,
+    /// along with its texture, frame buffer objects and render
+    /// buffers. Otherwise a new render texture is created.
+    ///
+    /// A reused render texture has its default view, smoothing
+    /// and repeating disabled, like a new one. Its contents are
+    /// undefined: call clear() on it before drawing.
+    ///
+    /// The returned render texture is owned by the caller until
+    /// it is given back with release, or destroyed with discard.
+    /// It must not be destroyed with delete while the pool is alive.
+    ///
+    /// \param width    Width of the render texture
+    /// \param height   Height of the render texture
+    /// \param settings Additional settings for the underlying OpenGL texture and context
+    ///
+    /// \return Render texture, or NULL if its creation failed
+    ///
+    /// \see release, discard
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexture* acquire(unsigned int width, unsigned int height, const ContextSettings& settings = ContextSettings());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a render texture back to the pool
+    ///
+    /// The render texture becomes idle and may be returned by a
+    /// later call to acquire with the same size and settings.
+    /// Render textures which were not returned by acquire are
+    /// ignored.
+    ///
+    /// \param renderTexture Render texture previously returned by acquire
+    ///
+    /// \see acquire, discard
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(RenderTexture* renderTexture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy a render texture instead of giving it back to the pool
+    ///
+    /// This function must be used instead of delete to destroy
+    /// a render texture returned by acquire, for example when it
+    /// is known that no render texture of the same size and
+    /// settings will be needed again.
+    /// Render textures which were not returned by acquire are
+    /// ignored.
+    ///
+    /// \param renderTexture Render texture previously returned by acquire
+    ///
+    /// \see acquire, release
+    ///
+    ////////////////////////////////////////////////////////////
+    void discard(RenderTexture* renderTexture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of idle render textures
+    ///
+    /// \return Number of render textures waiting in the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getIdleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures created by the pool
+    ///
+    /// \return Number of calls to acquire that had to create a new render texture
+    ///
+    /// \see getReusedCount
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getCreatedCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures reused by the pool
+    ///
+    /// This is the number of allocations of a texture, frame
+    /// buffer objects and render buffers that were avoided.
+    ///
+    /// \return Number of calls to acquire that returned an idle render texture
+    ///
+    /// \see getCreatedCount
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getReusedCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy all the idle render textures
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Size and settings identifying compatible render textures
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Key
+    {
+        Key(unsigned int width, unsigned int height, const ContextSettings& settings);
+
+        bool operator <(const Key& right) const;
+
+        Uint32 values[9]; ///< Size followed by the relevant context settings
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the size and settings of an acquired render texture
+    ///
+    /// \param renderTexture Render texture returned by acquire
+    /// \param key           Size and settings of the render texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAcquired(const RenderTexture* renderTexture, const Key& key);
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    typedef std::map<Key, std::vector<RenderTexture*> > TextureTable;
+    typedef std::map<const RenderTexture*, Key>         KeyTable;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    TextureTable m_idleTextures;     ///< Idle render textures, grouped by size and settings
+    KeyTable     m_acquiredTextures; ///< Size and settings of the render textures currently acquired
+    std::size_t  m_createdCount;     ///< Number of render textures created
+    std::size_t  m_reusedCount;      ///< Number of render textures reused
+};
+
+} // namespace sf
+
+
+#endif // SFML_RENDERTEXTUREPOOL_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderTexturePool
+/// \ingroup graphics
+///
+/// Creating a sf::RenderTexture allocates a texture, one or
+/// more frame buffer objects and depth/stencil render buffers,
+/// and destroying it releases them all. This is expensive when
+/// temporary render targets are created and destroyed every
+/// frame, for example by a chain of post-processing effects.
+///
+/// sf::RenderTexturePool keeps render textures alive once they
+/// are no longer needed, so that they can be reused later by
+/// another part of the program which needs a render texture
+/// of the same size and settings.
+///
+/// getCreatedCount and getReusedCount can be used to check how
+/// effective the pool is.
+///
+/// Usage example:
+/// \code
+/// sf::RenderTexturePool pool;
+///
+/// // In the render loop
+/// sf::RenderTexture* blur = pool.acquire(800, 600);
+/// blur->clear();
+/// blur->draw(scene, &blurShader);
+/// blur->display();
+/// window.draw(sf::Sprite(blur->getTexture()));
+/// pool.release(blur);
+/// \endcode
+///
+/// \see sf::RenderTexture
+///
+////////////////////////////////////////////////////////////
@@ -33,6 +33,7 @@
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <vector>
 
 
 namespace sf
@@ -212,6 +213,23 @@ public:
     ////////////////////////////////////////////////////////////
     virtual Vector2f getPoint(std::size_t index) const = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the points of the shape
+    ///
+    /// The points are in local coordinates, like the ones
+    /// returned by getPoint. The default implementation calls
+    /// getPoint for each point; derived classes can override
+    /// this function when they are able to compute all the
+    /// points at once more efficiently.
+    ///
+    /// \param points Array to fill, must be large enough to hold \a count points
+    /// \param count  Number of points to get, must be equal to getPointCount()
+    ///
+    /// \see getPoint, getPointCount
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void getPoints(Vector2f* points, std::size_t count) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the local bounding rectangle of the entity
     ///
@@ -261,6 +279,7 @@ protected:
     /// This function must be called by the derived class everytime
     /// the shape's points change (i.e. the result of either
     /// getPointCount or getPoint is different).
+    /// The points are retrieved with a single call to getPoints.
     ///
     ////////////////////////////////////////////////////////////
     void update();
@@ -276,6 +295,16 @@ private:
     ////////////////////////////////////////////////////////////
     virtual void draw(RenderTarget& target, RenderStates states) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the shape
+    ///
+    /// \param bounds Rectangle to fill with the bounds of the shape
+    ///
+    /// \return Always true
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool getCullingBounds(FloatRect& bounds) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' color
     ///
@@ -305,15 +334,16 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const Texture* m_texture;          ///< Texture of the shape
-    IntRect        m_textureRect;      ///< Rectangle defining the area of the source texture to display
-    Color          m_fillColor;        ///< Fill color
-    Color          m_outlineColor;     ///< Outline color
-    float          m_outlineThickness; ///< Thickness of the shape's outline
-    VertexArray    m_vertices;         ///< Vertex array containing the fill geometry
-    VertexArray    m_outlineVertices;  ///< Vertex array containing the outline geometry
-    FloatRect      m_insideBounds;     ///< Bounding rectangle of the inside (fill)
-    FloatRect      m_bounds;           ///< Bounding rectangle of the whole shape (outline + fill)
+    const Texture*        m_texture;          ///< Texture of the shape
+    IntRect               m_textureRect;      ///< Rectangle defining the area of the source texture to display
+    Color                 m_fillColor;        ///< Fill color
+    Color                 m_outlineColor;     ///< Outline color
+    float                 m_outlineThickness; ///< Thickness of the shape's outline
+    VertexArray           m_vertices;         ///< Vertex array containing the fill geometry
+    VertexArray           m_outlineVertices;  ///< Vertex array containing the outline geometry
+    std::vector<Vector2f> m_points;           ///< Points retrieved by getPoints, kept so that updates don't reallocate them
+    FloatRect             m_insideBounds;     ///< Bounding rectangle of the inside (fill)
+    FloatRect             m_bounds;           ///< Bounding rectangle of the whole shape (outline + fill)
 };
 
 } // namespace sf
@@ -200,6 +200,16 @@ private:
     ////////////////////////////////////////////////////////////
     virtual void draw(RenderTarget& target, RenderStates states) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the sprite
+    ///
+    /// \param bounds Rectangle to fill with the bounds of the sprite
+    ///
+    /// \return Always true
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool getCullingBounds(FloatRect& bounds) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the vertices' positions
     ///
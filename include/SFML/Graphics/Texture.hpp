@@ -233,10 +233,13 @@ public:
     /// the texture's pixels from the graphics card and copies
     /// them to a new image, potentially applying transformations
     /// to pixels if necessary (texture may be padded or flipped).
+    /// It waits until the graphics card has finished rendering
+    /// to the texture; use sf::TextureReadback if you need to
+    /// retrieve the pixels frequently without stalling.
     ///
     /// \return Image containing the texture's pixels
     ///
-    /// \see loadFromImage
+    /// \see loadFromImage, sf::TextureReadback
     ///
     ////////////////////////////////////////////////////////////
     Image copyToImage() const;
@@ -596,6 +599,7 @@ private:
     friend class Text;
     friend class RenderTexture;
     friend class RenderTarget;
+    friend class TextureReadback;
 
     ////////////////////////////////////////////////////////////
     /// \brief Get a valid image size according to hardware support
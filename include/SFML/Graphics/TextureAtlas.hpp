@@ -0,0 +1,361 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_TEXTUREATLAS_HPP
+#define SFML_TEXTUREATLAS_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+class Image;
+
+////////////////////////////////////////////////////////////
+/// \brief Packs many images into a few large textures
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureAtlas : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty atlas with pages of 2048x2048 pixels,
+    /// 1 pixel of extruded padding around each image.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureAtlas();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the atlas with new settings
+    ///
+    /// All the images previously added to the atlas are removed.
+    /// The padding is the number of pixels kept around each
+    /// image, so that neighbour images don't bleed into each
+    /// other when the textures are smoothed or scaled. If
+    /// \a extrude is true, the padding is filled by repeating
+    /// the border pixels of the image, otherwise it is left
+    /// transparent.
+    ///
+    /// \param pageSize Size of the textures that contain the images
+    /// \param padding  Number of pixels around each image
+    /// \param extrude  Fill the padding with the border pixels of the image?
+    ///
+    /// \return True if the atlas was successfully created
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create(const Vector2u& pageSize, unsigned int padding = 1, bool extrude = true);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an image to the atlas
+    ///
+    /// The image is given the next index (i.e. getImageCount()
+    /// before the call). The image is copied, so it can be
+    /// destroyed after this call.
+    ///
+    /// \param image Image to add
+    ///
+    /// \return True if the image was added, false if it is too large to fit
+    ///         in a page or if the texture of a page couldn't be created
+    ///
+    /// \see getTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    bool add(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add several images to the atlas at once
+    ///
+    /// The images are given consecutive indices, in the same
+    /// order as in the array. Adding images in batches is more
+    /// efficient than adding them one by one: they are packed
+    /// from the tallest to the smallest, their pixels are copied
+    /// to the pages by several threads, and each modified page
+    /// is uploaded to the graphics card only once.
+    /// If any of the images is too large to fit in a page,
+    /// none of them is added. If the texture of a page can't
+    /// be created, the images are still added but the function
+    /// returns false; the upload is retried on the next call.
+    ///
+    /// \param images Array of images to add
+    /// \param count  Number of images in the array
+    ///
+    /// \return True if the images were added
+    ///
+    /// \see getTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    bool add(const Image* images, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of images stored in the atlas
+    ///
+    /// \return Number of images
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getImageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture which contains an image
+    ///
+    /// The returned reference stays valid as long as the atlas
+    /// is not recreated, even if other images are added.
+    ///
+    /// \param index Index of the image, must be lower than getImageCount()
+    ///
+    /// \return Texture of the page where the image is stored
+    ///
+    /// \see getTextureRect
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture& getTexture(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the area of an image in its texture
+    ///
+    /// The returned rectangle excludes the padding, and can
+    /// be passed directly to Sprite::setTextureRect.
+    ///
+    /// \param index Index of the image, must be lower than getImageCount()
+    ///
+    /// \return Area of the image in the texture returned by getTexture
+    ///
+    /// \see getTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    IntRect getTextureRect(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of pages (textures) of the atlas
+    ///
+    /// \return Number of pages
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getPageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter on the pages
+    ///
+    /// \param smooth True to enable smoothing, false to disable it
+    ///
+    /// \see Texture::setSmooth
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the atlas to files
+    ///
+    /// The layout of the atlas (settings, position of each image
+    /// and free space of each page) is written to \a filename,
+    /// and the pages are saved as PNG images next to it, named
+    /// after \a filename followed by the page number and ".png".
+    /// Loading them back with loadFromFile is much faster than
+    /// adding all the images again.
+    ///
+    /// \param filename Path of the layout file to write
+    ///
+    /// \return True if saving was successful
+    ///
+    /// \see loadFromFile
+    ///
+    ////////////////////////////////////////////////////////////
+    bool saveToFile(const std::string& filename) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load an atlas previously saved with saveToFile
+    ///
+    /// The images keep the indices they had when the atlas was
+    /// saved, and new images can be added after loading.
+    /// If loading fails, the atlas is left unchanged.
+    ///
+    /// \param filename Path of the layout file to read
+    ///
+    /// \return True if loading was successful
+    ///
+    /// \see saveToFile
+    ///
+    ////////////////////////////////////////////////////////////
+    bool loadFromFile(const std::string& filename);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Segment of the top outline of the packed images
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Segment
+    {
+        unsigned int x;     ///< Left coordinate of the segment
+        unsigned int y;     ///< Height of the outline along the segment
+        unsigned int width; ///< Width of the segment
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Texture of the atlas and its copy in system memory
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Page
+    {
+        Texture              texture;     ///< Texture where the images are stored
+        std::vector<Uint8>   pixels;      ///< Copy of the texture pixels in system memory
+        std::vector<Segment> skyline;     ///< Outline of the occupied area, from left to right
+        unsigned int         dirtyTop;    ///< First row modified since the last upload
+        unsigned int         dirtyBottom; ///< Row after the last one modified since the last upload
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Location of an image in the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::size_t page; ///< Index of the page containing the image
+        IntRect     rect; ///< Area of the image in the page, without padding
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a place for a rectangle in a page
+    ///
+    /// \param page   Page to search
+    /// \param width  Width of the rectangle, padding included
+    /// \param height Height of the rectangle, padding included
+    /// \param x      Receives the left coordinate of the place found
+    /// \param y      Receives the top coordinate of the place found
+    ///
+    /// \return True if a place was found
+    ///
+    ////////////////////////////////////////////////////////////
+    bool insert(Page& page, unsigned int width, unsigned int height, unsigned int& x, unsigned int& y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a new empty page to the atlas
+    ///
+    /// \return The new page
+    ///
+    ////////////////////////////////////////////////////////////
+    Page& addPage();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the modified rows of a page to its texture
+    ///
+    /// \param page     Page to upload
+    /// \param pageSize Size of the page
+    ///
+    /// \return False if the texture of the page couldn't be created
+    ///
+    ////////////////////////////////////////////////////////////
+    bool uploadPage(Page& page, const Vector2u& pageSize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the modified rows of the pages to their textures
+    ///
+    /// \return False if the texture of any page couldn't be created
+    ///
+    ////////////////////////////////////////////////////////////
+    bool uploadPages();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy all the pages and images
+    ///
+    ////////////////////////////////////////////////////////////
+    void cleanup();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2u           m_pageSize; ///< Size of the pages
+    unsigned int       m_padding;  ///< Number of pixels around each image
+    bool               m_extrude;  ///< Is the padding filled with the border pixels of the images?
+    bool               m_isSmooth; ///< Status of the smooth filter of the pages
+    std::vector<Page*> m_pages;    ///< Pages of the atlas, allocated separately so that their textures never move
+    std::vector<Entry> m_entries;  ///< Location of each image
+};
+
+} // namespace sf
+
+
+#endif // SFML_TEXTUREATLAS_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureAtlas
+/// \ingroup graphics
+///
+/// Drawing many sprites that each use their own small texture
+/// is slow: the render target has to bind a different texture
+/// for each of them. sf::TextureAtlas packs many images into a
+/// few large textures (called pages), so that sprites that use
+/// images of the same page share the same texture.
+///
+/// Images can be added at any time; each one is identified by
+/// its index, which is the order in which it was added. Pages
+/// are created as needed, and only the modified part of a page
+/// is uploaded to the graphics card when images are added.
+///
+/// Each image is surrounded by a padding, by default filled
+/// with its border pixels, so that smoothing or scaling doesn't
+/// make neighbour images bleed into each other.
+///
+/// The packed atlas can be saved with saveToFile and loaded
+/// back with loadFromFile, to avoid packing the images again
+/// every time the application starts.
+///
+/// Usage example:
+/// \code
+/// // Pack the images
+/// sf::TextureAtlas atlas;
+/// if (!atlas.loadFromFile("atlas.txt"))
+/// {
+///     std::vector<sf::Image> images = ...;
+///     atlas.add(&images[0], images.size());
+///     atlas.saveToFile("atlas.txt");
+/// }
+///
+/// // Use the 42nd image in a sprite
+/// sf::Sprite sprite;
+/// sprite.setTexture(atlas.getTexture(42));
+/// sprite.setTextureRect(atlas.getTextureRect(42));
+/// \endcode
+///
+/// \see sf::Texture, sf::Image, sf::Sprite
+///
+////////////////////////////////////////////////////////////
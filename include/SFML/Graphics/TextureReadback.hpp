@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_TEXTUREREADBACK_HPP
+#define SFML_TEXTUREREADBACK_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Window/GlResource.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Asynchronous transfer of a texture's pixels to
+///        system memory
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureReadback : GlResource, NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start copying the pixels of a texture
+    ///
+    /// This function only queues the transfer and returns
+    /// immediately: the pixels are copied by the graphics
+    /// driver in the background. The texture can be modified
+    /// or destroyed right after this call, the transfer always
+    /// captures its contents at the time of the request.
+    ///
+    /// If a previous request was not fetched yet, it is discarded.
+    ///
+    /// If asynchronous transfers are not supported by the
+    /// system, the pixels are copied immediately (exactly
+    /// like Texture::copyToImage does).
+    ///
+    /// \param texture Texture to copy
+    ///
+    /// \return True if the transfer was started, false if the texture is empty
+    ///
+    /// \see isReady, fetch
+    ///
+    ////////////////////////////////////////////////////////////
+    bool request(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a request is waiting to be fetched
+    ///
+    /// \return True if request was called and fetch wasn't yet
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isPending() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pending transfer has completed
+    ///
+    /// When this function returns true, fetch will not
+    /// wait for the graphics driver. If fence objects are
+    /// not supported by the system, this function returns
+    /// true as soon as a request is pending; in this case
+    /// waiting one or two frames before calling fetch
+    /// usually avoids any stall.
+    ///
+    /// \return True if the pixels can be fetched without waiting
+    ///
+    /// \see fetch
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isReady() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the pixels of the pending transfer
+    ///
+    /// If the transfer is not complete yet, this function
+    /// waits until it is. After this call, no request is
+    /// pending anymore.
+    ///
+    /// \param image Image to fill with the pixels of the texture
+    ///
+    /// \return True if the image was filled, false if no request was pending
+    ///
+    /// \see request, isReady
+    ///
+    ////////////////////////////////////////////////////////////
+    bool fetch(Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports
+    ///        asynchronous texture transfers
+    ///
+    /// This function should always be called before using
+    /// the asynchronous path, and if it returns false, then
+    /// every request will be performed synchronously.
+    ///
+    /// \return True if asynchronous transfers are supported, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isAvailable();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the fence of the pending transfer
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseSync();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int       m_buffer;     ///< OpenGL pixel buffer object identifier
+    std::size_t        m_bufferSize; ///< Size of the pixel buffer, in bytes
+    void*              m_sync;       ///< Fence signaled when the transfer is complete
+    Vector2u           m_size;       ///< Size of the requested texture, in pixels
+    Vector2u           m_actualSize; ///< Size of the texture storage, including padding
+    bool               m_flipped;    ///< Are the pixels of the requested texture flipped?
+    bool               m_pending;    ///< Is there a request waiting to be fetched?
+    Image              m_image;      ///< Pixels of a request performed synchronously
+    std::vector<Uint8> m_pixels;     ///< Temporary storage used to remove padding and flipping
+};
+
+} // namespace sf
+
+
+#endif // SFML_TEXTUREREADBACK_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureReadback
+/// \ingroup graphics
+///
+/// Texture::copyToImage waits until the graphics driver has
+/// finished rendering to the texture and transferred its pixels,
+/// which stalls the whole pipeline. sf::TextureReadback splits
+/// this operation in two steps: request queues the transfer
+/// into a buffer owned by the driver, and fetch retrieves
+/// the pixels later, typically one or two frames after.
+///
+/// Several instances can be used in rotation to capture a
+/// sf::RenderTexture every frame without ever waiting:
+///
+/// Usage example:
+/// \code
+/// sf::RenderTexture target;
+/// target.create(1280, 720);
+///
+/// sf::TextureReadback readbacks[3];
+/// std::size_t frame = 0;
+/// sf::Image capture;
+///
+/// while (recording)
+/// {
+///     // draw the frame...
+///     target.display();
+///
+///     // Retrieve the frame captured a few frames ago, if it is available
+///     sf::TextureReadback& readback = readbacks[frame % 3];
+///     if (readback.isPending() && readback.fetch(capture))
+///         encode(capture);
+///
+///     // Queue the capture of the current frame
+///     readback.request(target.getTexture());
+///     ++frame;
+/// }
+/// \endcode
+///
+/// \see sf::Texture, sf::RenderTexture, sf::Image
+///
+////////////////////////////////////////////////////////////
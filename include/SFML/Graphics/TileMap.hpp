@@ -0,0 +1,307 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_TILEMAP_HPP
+#define SFML_TILEMAP_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <vector>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Drawable grid of tiles taken from a tileset texture,
+///        stored in chunks of vertex buffers
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Drawable, public Transformable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    // Static member data
+    ////////////////////////////////////////////////////////////
+    static const Uint32 NoTile; ///< Special tile value for cells that are left empty
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty tile map with no tileset texture.
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the tile map
+    ///
+    /// All the cells of the new map are set to NoTile.
+    /// The map is split into square chunks of \a chunkSize x
+    /// \a chunkSize tiles; each chunk is stored in its own vertex
+    /// buffer, which is only updated when one of its tiles changes
+    /// and only drawn when it is inside the current view.
+    ///
+    /// \param mapSize   Size of the map, in tiles
+    /// \param tileSize  Size of a tile, in pixels
+    /// \param chunkSize Number of tiles along each side of a chunk
+    ///
+    /// \return True if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool create(const Vector2u& mapSize, const Vector2u& tileSize, unsigned int chunkSize = 32);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tileset texture of the tile map
+    ///
+    /// The tileset is a grid of tiles of the size passed to
+    /// create(), numbered from left to right and from top to
+    /// bottom, starting at 0.
+    /// The \a texture argument refers to a texture that must
+    /// exist as long as the tile map uses it. Indeed, the tile map
+    /// doesn't store its own copy of the texture, but rather keeps
+    /// a pointer to the one that you passed to this function.
+    /// If the source texture is destroyed and the tile map tries to
+    /// use it, the behavior is undefined.
+    ///
+    /// \param texture New tileset texture
+    ///
+    /// \see getTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tileset texture of the tile map
+    ///
+    /// If the tile map has no tileset texture, a NULL pointer is returned.
+    ///
+    /// \return Pointer to the tile map's tileset texture
+    ///
+    /// \see setTexture
+    ///
+    ////////////////////////////////////////////////////////////
+    const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tile of a cell
+    ///
+    /// Only the chunk that contains the cell is marked for update;
+    /// its vertex buffer is rebuilt the next time it is drawn.
+    /// This function doesn't check \a x and \a y against the size
+    /// of the map, for performance reasons.
+    ///
+    /// \param x    X coordinate of the cell, in tiles
+    /// \param y    Y coordinate of the cell, in tiles
+    /// \param tile Index of the tile in the tileset, or NoTile
+    ///
+    /// \see getTile
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(unsigned int x, unsigned int y, Uint32 tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tile of a cell
+    ///
+    /// This function doesn't check \a x and \a y against the size
+    /// of the map, for performance reasons.
+    ///
+    /// \param x X coordinate of the cell, in tiles
+    /// \param y Y coordinate of the cell, in tiles
+    ///
+    /// \return Index of the tile in the tileset, or NoTile
+    ///
+    /// \see setTile
+    ///
+    ////////////////////////////////////////////////////////////
+    Uint32 getTile(unsigned int x, unsigned int y) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map
+    ///
+    /// \return Size of the map, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2u& getMapSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile
+    ///
+    /// \return Size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    const Vector2u& getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a chunk
+    ///
+    /// \return Number of tiles along each side of a chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getChunkSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// entity in the entity's coordinate system.
+    ///
+    /// \return Local bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// tile map in the global 2D world's coordinate system.
+    ///
+    /// \return Global bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    FloatRect getGlobalBounds() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the visible chunks of the tile map to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the tile map
+    ///
+    /// \param bounds Rectangle to fill with the bounds of the tile map
+    ///
+    /// \return Always true
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool getCullingBounds(FloatRect& bounds) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rebuild the geometry of a chunk
+    ///
+    /// \param chunkX     X coordinate of the chunk, in chunks
+    /// \param chunkY     Y coordinate of the chunk, in chunks
+    /// \param useBuffer  Upload the geometry to the chunk's vertex buffer?
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateChunk(unsigned int chunkX, unsigned int chunkY, bool useBuffer) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Geometry of a square block of tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        Chunk();
+
+        VertexBuffer        buffer;      ///< Vertices of the chunk, when vertex buffers are available
+        std::vector<Vertex> vertices;    ///< Vertices of the chunk, when vertex buffers are not available
+        std::size_t         vertexCount; ///< Number of vertices of the non-empty tiles
+        bool                needsUpdate; ///< Has a tile of the chunk changed since the last update?
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Uint32>         m_tiles;          ///< Tile of each cell, row by row
+    mutable std::vector<Chunk>  m_chunks;         ///< Chunks of the map, row by row
+    mutable std::vector<Vertex> m_vertices;       ///< Temporary storage used to fill the vertex buffers
+    const Texture*              m_texture;        ///< Tileset texture
+    mutable unsigned int        m_tilesetColumns; ///< Number of tiles per row of the tileset used by the chunks
+    Vector2u                    m_mapSize;        ///< Size of the map, in tiles
+    Vector2u                    m_tileSize;       ///< Size of a tile, in pixels
+    unsigned int                m_chunkSize;      ///< Number of tiles along each side of a chunk
+    Vector2u                    m_chunkCount;     ///< Number of chunks in each direction
+};
+
+} // namespace sf
+
+
+#endif // SFML_TILEMAP_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// sf::TileMap draws a large grid of tiles taken from a single
+/// tileset texture. It is much more efficient than drawing one
+/// sprite per tile, or than rebuilding a huge sf::VertexArray
+/// every frame:
+/// \li the map is split into chunks, each stored in its own
+///     sf::VertexBuffer so that it stays in graphics memory
+/// \li only the chunks whose tiles changed are uploaded again,
+///     and only when they are drawn
+/// \li only the chunks that intersect the current view are drawn
+///
+/// When vertex buffers are not supported by the system, the
+/// chunks are kept in system memory and drawn like vertex arrays.
+///
+/// Cells set to sf::TileMap::NoTile produce no geometry at all.
+///
+/// Usage example:
+/// \code
+/// // Load the tileset, made of 32x32 tiles
+/// sf::Texture tileset;
+/// tileset.loadFromFile("tileset.png");
+///
+/// // Create a 1024x1024 map
+/// sf::TileMap map;
+/// map.create(sf::Vector2u(1024, 1024), sf::Vector2u(32, 32));
+/// map.setTexture(tileset);
+///
+/// // Fill it
+/// for (unsigned int y = 0; y < 1024; ++y)
+///     for (unsigned int x = 0; x < 1024; ++x)
+///         map.setTile(x, y, level[y][x]);
+///
+/// // Draw it
+/// window.draw(map);
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::Texture, sf::Transformable
+///
+////////////////////////////////////////////////////////////
@@ -31,10 +31,13 @@
 #include <SFML/Graphics/Export.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <cstddef>
 
 
 namespace sf
 {
+class Vertex;
+
 ////////////////////////////////////////////////////////////
 /// \brief Define a 3x3 transform matrix
 ///
@@ -118,6 +121,36 @@ public:
     ////////////////////////////////////////////////////////////
     Vector2f transformPoint(const Vector2f& point) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of 2D points
+    ///
+    /// This function gives the same results as calling
+    /// transformPoint for every point, but processes several
+    /// points at once with vector instructions when the
+    /// processor supports them. \a points and \a result can
+    /// point to the same array.
+    ///
+    /// \param points Array of points to transform
+    /// \param result Array to fill with the transformed points
+    /// \param count  Number of points in both arrays
+    ///
+    ////////////////////////////////////////////////////////////
+    void transformPoints(const Vector2f* points, Vector2f* result, std::size_t count) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform the positions of an array of vertices
+    ///
+    /// The positions are transformed in place, colors and
+    /// texture coordinates are left unchanged. Like
+    /// transformPoints, several vertices are processed at
+    /// once when the processor supports it.
+    ///
+    /// \param vertices Array of vertices to transform
+    /// \param count    Number of vertices in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void transformVertices(Vertex* vertices, std::size_t count) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Transform a rectangle
     ///
@@ -355,6 +388,14 @@ public:
 
 private:
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the last row of the matrix is (0, 0, 1)
+    ///
+    /// \return True if the transform is affine
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isAffine() const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -168,9 +168,30 @@ public:
     ///
     /// \return Bounding rectangle of the vertex array
     ///
+    /// \see computeBounds
+    ///
     ////////////////////////////////////////////////////////////
     FloatRect getBounds() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the bounding rectangle of an array of vertices
+    ///
+    /// This function returns the minimal axis-aligned rectangle
+    /// that contains all the given vertices. Several vertices
+    /// are processed at once with vector instructions when the
+    /// processor supports them, which makes it suitable for
+    /// large arrays such as particle systems.
+    ///
+    /// \param vertices Pointer to the vertices
+    /// \param count    Number of vertices in the array
+    ///
+    /// \return Bounding rectangle of the vertices, or an empty rectangle if \a count is 0
+    ///
+    /// \see getBounds, Transform::transformVertices
+    ///
+    ////////////////////////////////////////////////////////////
+    static FloatRect computeBounds(const Vertex* vertices, std::size_t count);
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -182,6 +203,16 @@ private:
     ////////////////////////////////////////////////////////////
     virtual void draw(RenderTarget& target, RenderStates states) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds used to cull the vertex array
+    ///
+    /// \param bounds Rectangle to fill with the bounds of the vertex array
+    ///
+    /// \return Always true
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual bool getCullingBounds(FloatRect& bounds) const;
+
 private:
 
     ////////////////////////////////////////////////////////////
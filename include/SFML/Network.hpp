@@ -39,6 +39,7 @@
 #include <SFML/Network/SocketSelector.hpp>
 #include <SFML/Network/TcpListener.hpp>
 #include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/TcpSocketPool.hpp>
 #include <SFML/Network/UdpSocket.hpp>
 
 
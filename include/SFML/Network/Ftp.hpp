@@ -247,6 +247,40 @@ public:
         std::vector<std::string> m_listing; ///< Directory/file names extracted from the data
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Abstract class for monitoring file transfers
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_NETWORK_API TransferListener
+    {
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Virtual destructor
+        ///
+        ////////////////////////////////////////////////////////////
+        virtual ~TransferListener() {}
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Called each time a block of data is transferred
+        ///
+        /// When a download is resumed, \a transferred includes
+        /// the part of the file that was already present.
+        ///
+        /// \param transferred Number of bytes of the file transferred so far
+        /// \param total       Total size of the file, in bytes, or 0 if unknown
+        ///
+        /// \return True to continue the transfer, false to abort it
+        ///
+        ////////////////////////////////////////////////////////////
+        virtual bool onProgress(Uint64 transferred, Uint64 total) = 0;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Ftp();
 
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
@@ -467,6 +501,38 @@ public:
     ////////////////////////////////////////////////////////////
     Response download(const std::string& remoteFile, const std::string& localPath, TransferMode mode = Binary);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Download a file from the server, with resume
+    ///        support and progress reporting
+    ///
+    /// This function behaves like the other overload of download,
+    /// with two additions.
+    ///
+    /// If \a resume is true and the local file already exists,
+    /// it is considered as the beginning of the distant file:
+    /// the server is asked (with the REST command) to send only
+    /// the missing part, which is appended to the local file.
+    /// If the server doesn't support it, the whole file is
+    /// downloaded again. When resuming, the local file is kept
+    /// even if the transfer fails, so that it can be resumed
+    /// again later.
+    ///
+    /// If \a listener is not NULL, it is notified of the progress
+    /// of the transfer, and can abort it.
+    ///
+    /// \param remoteFile Filename of the distant file to download
+    /// \param localPath  The directory in which to put the file on the local computer
+    /// \param mode       Transfer mode
+    /// \param resume     Pass true to resume a previous partial download
+    /// \param listener   Listener to notify of the progress of the transfer, or NULL
+    ///
+    /// \return Server response to the request
+    ///
+    /// \see upload, setTransferBufferSize
+    ///
+    ////////////////////////////////////////////////////////////
+    Response download(const std::string& remoteFile, const std::string& localPath, TransferMode mode, bool resume, TransferListener* listener = NULL);
+
     ////////////////////////////////////////////////////////////
     /// \brief Upload a file to the server
     ///
@@ -490,6 +556,50 @@ public:
     ////////////////////////////////////////////////////////////
     Response upload(const std::string& localFile, const std::string& remotePath, TransferMode mode = Binary, bool append = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a file to the server, with progress reporting
+    ///
+    /// This function behaves like the other overload of upload,
+    /// except that \a listener is notified of the progress of
+    /// the transfer, and can abort it.
+    ///
+    /// \param localFile  Path of the local file to upload
+    /// \param remotePath The directory in which to put the file on the server
+    /// \param mode       Transfer mode
+    /// \param append     Pass true to append to or false to overwrite the remote file if it already exists
+    /// \param listener   Listener to notify of the progress of the transfer
+    ///
+    /// \return Server response to the request
+    ///
+    /// \see download, setTransferBufferSize
+    ///
+    ////////////////////////////////////////////////////////////
+    Response upload(const std::string& localFile, const std::string& remotePath, TransferMode mode, bool append, TransferListener* listener);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the buffer used for file transfers
+    ///
+    /// Larger buffers reduce the number of system calls made
+    /// during uploads and downloads, at the cost of memory.
+    /// The default size is 64 KB.
+    ///
+    /// \param size Size of the transfer buffer, in bytes
+    ///
+    /// \see getTransferBufferSize
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTransferBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the buffer used for file transfers
+    ///
+    /// \return Size of the transfer buffer, in bytes
+    ///
+    /// \see setTransferBufferSize
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getTransferBufferSize() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Send a command to the FTP server
     ///
@@ -533,8 +643,9 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    TcpSocket   m_commandSocket; ///< Socket holding the control connection with the server
-    std::string m_receiveBuffer; ///< Received command data that is yet to be processed
+    TcpSocket   m_commandSocket;      ///< Socket holding the control connection with the server
+    std::string m_receiveBuffer;      ///< Received command data that is yet to be processed
+    std::size_t m_transferBufferSize; ///< Size of the buffer used for file transfers
 };
 
 } // namespace sf
@@ -604,6 +715,11 @@ private:
 /// if (response.isOk())
 ///     std::cout << "File uploaded" << std::endl;
 ///
+/// // Download a big file, resuming any previous partial download
+/// response = ftp.download("files/big.zip", "local-path", sf::Ftp::Binary, true);
+/// if (response.isOk())
+///     std::cout << "File downloaded" << std::endl;
+///
 /// // Send specific commands (here: FEAT to list supported FTP features)
 /// response = ftp.sendCommand("FEAT");
 /// if (response.isOk())
@@ -35,6 +35,7 @@
 #include <SFML/System/Time.hpp>
 #include <map>
 #include <string>
+#include <vector>
 
 
 namespace sf
@@ -345,6 +346,52 @@ public:
         std::string  m_body;         ///< Body of the response
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Abstract class for receiving the body of a
+    ///        response as it arrives
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_NETWORK_API ResponseHandler
+    {
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Virtual destructor
+        ///
+        ////////////////////////////////////////////////////////////
+        virtual ~ResponseHandler() {}
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Called when the header of the response is received
+        ///
+        /// This function is called once, before any call to onBody.
+        /// The response contains the status and the header fields,
+        /// but its body is empty.
+        /// The default implementation accepts every response.
+        ///
+        /// \param response Response whose header was received
+        ///
+        /// \return True to receive the body, false to abort the transfer
+        ///
+        ////////////////////////////////////////////////////////////
+        virtual bool onHeader(const Response& response);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Called when a new part of the body is received
+        ///
+        /// The data is already decoded: chunked transfer encoding
+        /// is handled by sf::Http, so the handler only receives
+        /// the actual content of the body, in order.
+        ///
+        /// \param data Pointer to the received bytes
+        /// \param size Number of bytes
+        ///
+        /// \return True to continue the transfer, false to abort it
+        ///
+        ////////////////////////////////////////////////////////////
+        virtual bool onBody(const char* data, std::size_t size) = 0;
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -396,6 +443,14 @@ public:
     /// of Time::Zero means that the client will use the system default timeout
     /// (which is usually pretty long).
     ///
+    /// If the request has its "Connection" field set to "keep-alive"
+    /// and the server agrees, the connection is kept open after the
+    /// response is received, and reused by the next request sent to
+    /// the same host. If the server closed a reused connection in the
+    /// meantime, GET and HEAD requests are sent again on a new
+    /// connection; other requests fail with the ConnectionFailed status,
+    /// since the server may already have processed them.
+    ///
     /// \param request Request to send
     /// \param timeout Maximum time to wait
     ///
@@ -404,12 +459,106 @@ public:
     ////////////////////////////////////////////////////////////
     Response sendRequest(const Request& request, Time timeout = Time::Zero);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and stream the server's response
+    ///        to a handler
+    ///
+    /// This function behaves like the other overload of sendRequest,
+    /// except that the body of the response is not stored in memory:
+    /// it is given to \a handler, piece by piece, as soon as it is
+    /// received. This is the function to use for downloading large
+    /// resources.
+    ///
+    /// The body length is determined by the "Content-Length" field,
+    /// by the chunked transfer encoding, or by the server closing
+    /// the connection.
+    ///
+    /// \param request Request to send
+    /// \param handler Handler that receives the header and the body
+    /// \param timeout Maximum time to wait
+    ///
+    /// \return Server's response, with an empty body
+    ///
+    ////////////////////////////////////////////////////////////
+    Response sendRequest(const Request& request, ResponseHandler& handler, Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several HTTP requests at once and return the
+    ///        server's responses
+    ///
+    /// The first request is sent alone on a new connection. Once the
+    /// server has confirmed that it keeps the connection alive, the
+    /// following requests are pipelined: they are sent without
+    /// waiting for the responses, which are then received in order.
+    /// For this to be effective, the requests should have their
+    /// "Connection" field set to "keep-alive"; otherwise each of
+    /// them is sent on its own connection.
+    /// Only GET and HEAD requests are pipelined: a request of
+    /// any other method is sent only after the responses to the
+    /// previous ones, and is followed by nothing until its own
+    /// response is received.
+    /// If the server closes the connection before answering all the
+    /// pipelined requests, the remaining ones are sent again on a
+    /// new connection, unless one of them is neither a GET nor a
+    /// HEAD request: the exchange then stops, and the responses
+    /// of the unanswered requests have the ConnectionFailed status.
+    ///
+    /// \param requests Requests to send
+    /// \param timeout  Maximum time to wait
+    ///
+    /// \return Server's responses, in the same order as \a requests
+    ///
+    ////////////////////////////////////////////////////////////
+    std::vector<Response> sendRequests(const std::vector<Request>& requests, Time timeout = Time::Zero);
+
 private:
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send requests and receive their responses
+    ///
+    /// \param requests  Requests to send
+    /// \param responses Responses to fill, must have the same size as \a requests
+    /// \param handler   Handler that receives the bodies, or NULL to store them in the responses
+    /// \param timeout   Maximum time to wait
+    ///
+    ////////////////////////////////////////////////////////////
+    void exchange(const std::vector<Request>& requests, std::vector<Response>& responses, ResponseHandler* handler, Time timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the missing mandatory fields to a request
+    ///
+    /// \param request Request to complete
+    ///
+    /// \return True if the request asks to keep the connection alive
+    ///
+    ////////////////////////////////////////////////////////////
+    bool completeRequest(Request& request) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive the response to a request sent on the
+    ///        current connection
+    ///
+    /// \param response Response to fill with the header
+    /// \param handler  Handler that receives the body
+    /// \param hasBody  Whether the request expects a body in the response
+    ///
+    /// \return True if the connection can be reused for another request
+    ///
+    ////////////////////////////////////////////////////////////
+    bool receiveResponse(Response& response, ResponseHandler& handler, bool hasBody);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close the connection with the host
+    ///
+    ////////////////////////////////////////////////////////////
+    void disconnect();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     TcpSocket      m_connection; ///< Connection to the host
+    bool           m_connected;  ///< Is the connection kept alive from a previous request?
+    std::string    m_pending;    ///< Data received after the end of the last response
     IpAddress      m_host;       ///< Web host address
     std::string    m_hostName;   ///< Web host name
     unsigned short m_port;       ///< Port used for connection with host
@@ -479,4 +628,43 @@ private:
 /// }
 /// \endcode
 ///
+/// By default, a new connection is opened for every request.
+/// When sending many requests to the same host, asking the server
+/// to keep the connection alive avoids paying for a new connection
+/// each time:
+/// \code
+/// sf::Http::Request request("score.php", sf::Http::Request::Post);
+/// request.setHttpVersion(1, 1);
+/// request.setField("Connection", "keep-alive");
+/// \endcode
+///
+/// Large resources can be downloaded without keeping them in
+/// memory, by giving a sf::Http::ResponseHandler to sendRequest:
+/// \code
+/// class FileWriter : public sf::Http::ResponseHandler
+/// {
+/// public:
+///
+///     FileWriter(std::ofstream& file) : m_file(file) {}
+///
+///     virtual bool onHeader(const sf::Http::Response& response)
+///     {
+///         return response.getStatus() == sf::Http::Response::Ok;
+///     }
+///
+///     virtual bool onBody(const char* data, std::size_t size)
+///     {
+///         return m_file.write(data, size).good();
+///     }
+///
+/// private:
+///
+///     std::ofstream& m_file;
+/// };
+///
+/// std::ofstream file("patch.bin", std::ios::binary);
+/// FileWriter writer(file);
+/// http.sendRequest(sf::Http::Request("patch.bin"), writer);
+/// \endcode
+///
 ////////////////////////////////////////////////////////////
@@ -332,6 +332,185 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator <<(const String&       data);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an unsigned integer as a variable-length
+    ///        quantity (LEB128)
+    ///
+    /// Small values take less space than their fixed-size
+    /// counterparts: values below 128 are encoded in a single
+    /// byte, values below 16384 in two bytes, and so on up
+    /// to 10 bytes for the full 64-bit range.
+    ///
+    /// \param data Value to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see readVarUint, writeVarInt
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeVarUint(Uint64 data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a signed integer as a variable-length
+    ///        quantity
+    ///
+    /// The value is zig-zag encoded before being written with
+    /// writeVarUint, so that values close to zero (positive or
+    /// negative) are encoded with few bytes.
+    ///
+    /// \param data Value to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see readVarInt, writeVarUint
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeVarInt(Int64 data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a string prefixed with a variable-length size
+    ///
+    /// Unlike operator <<, which always prefixes strings with
+    /// a 32-bit length, this function stores the length with
+    /// writeVarUint.
+    ///
+    /// \param data String to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see readVarString
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeVarString(const std::string& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the lowest bits of an integer
+    ///
+    /// Consecutive calls to writeBits (and writeBool,
+    /// writeQuantizedFloat) are packed together in the same
+    /// bytes. Any other write operation starts at the next
+    /// byte boundary.
+    ///
+    /// \param data     Value whose lowest bits are written
+    /// \param bitCount Number of bits to write, in range [1, 32]
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see readBits
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeBits(Uint32 data, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a boolean as a single bit
+    ///
+    /// \param data Value to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see readBool, writeBits
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeBool(bool data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a floating point number quantized to a
+    ///        given number of bits
+    ///
+    /// The value is clamped to [min, max] and mapped to one
+    /// of the 2^bitCount evenly spaced steps of this range.
+    /// The same range and bit count must be used to read
+    /// it back.
+    ///
+    /// \param data     Value to write
+    /// \param min      Lower bound of the range of the value
+    /// \param max      Upper bound of the range of the value
+    /// \param bitCount Number of bits to use, in range [1, 32]
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see readQuantizedFloat, writeBits
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeQuantizedFloat(float data, float min, float max, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an unsigned variable-length integer
+    ///
+    /// \param data Variable to fill with the value read
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see writeVarUint
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readVarUint(Uint64& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a signed variable-length integer
+    ///
+    /// \param data Variable to fill with the value read
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see writeVarInt
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readVarInt(Int64& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a string prefixed with a variable-length size
+    ///
+    /// \param data String to fill with the value read
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see writeVarString
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readVarString(std::string& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an integer written with writeBits
+    ///
+    /// \param data     Variable to fill with the value read
+    /// \param bitCount Number of bits to read, in range [1, 32]
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see writeBits
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readBits(Uint32& data, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a boolean written with writeBool
+    ///
+    /// \param data Variable to fill with the value read
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see writeBool
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readBool(bool& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a floating point number written with
+    ///        writeQuantizedFloat
+    ///
+    /// \param data     Variable to fill with the value read
+    /// \param min      Lower bound of the range of the value
+    /// \param max      Upper bound of the range of the value
+    /// \param bitCount Number of bits used, in range [1, 32]
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see writeQuantizedFloat
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readQuantizedFloat(float& data, float min, float max, unsigned int bitCount);
+
 protected:
 
     friend class TcpSocket;
@@ -397,13 +576,27 @@ private:
     ////////////////////////////////////////////////////////////
     bool checkSize(std::size_t size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if the packet can extract a given number of bits
+    ///
+    /// This function updates accordingly the state of the packet.
+    ///
+    /// \param bitCount Number of bits to check
+    ///
+    /// \return True if \a bitCount bits can be read from the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    bool checkBits(std::size_t bitCount);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<char> m_data;    ///< Data stored in the packet
-    std::size_t       m_readPos; ///< Current reading position in the packet
-    std::size_t       m_sendPos; ///< Current send position in the packet (for handling partial sends)
-    bool              m_isValid; ///< Reading state of the packet
+    std::vector<char> m_data;        ///< Data stored in the packet
+    std::size_t       m_readPos;     ///< Current reading position in the packet
+    std::size_t       m_sendPos;     ///< Current send position in the packet (for handling partial sends)
+    bool              m_isValid;     ///< Reading state of the packet
+    unsigned int      m_readBitPos;  ///< Number of bits already read in the byte at m_readPos
+    unsigned int      m_writeBitPos; ///< Number of bits already written in the last byte (0 if byte-aligned)
 };
 
 } // namespace sf
@@ -470,6 +663,33 @@ private:
 /// \li floating point numbers (float, double)
 /// \li string types (char*, wchar_t*, std::string, std::wstring, sf::String)
 ///
+/// When bandwidth matters, packets also provide a compact
+/// encoding through named functions: integers can be written as
+/// variable-length quantities (writeVarUint, writeVarInt), strings
+/// can be prefixed with a variable-length size (writeVarString),
+/// and booleans, small integers and quantized floats can be
+/// packed at the bit level (writeBool, writeBits,
+/// writeQuantizedFloat). Each of them has a matching read
+/// function, which must be called in the same order.
+///
+/// \code
+/// sf::Packet packet;
+/// packet.writeVarUint(entityId)
+///       .writeBool(isVisible)
+///       .writeBits(animationFrame, 5)
+///       .writeQuantizedFloat(angle, 0.f, 360.f, 10);
+///
+/// ...
+///
+/// if (packet.readVarUint(entityId)
+///           .readBool(isVisible)
+///           .readBits(animationFrame, 5)
+///           .readQuantizedFloat(angle, 0.f, 360.f, 10))
+/// {
+///     // Data extracted successfully...
+/// }
+/// \endcode
+///
 /// Like standard streams, it is also possible to define your own
 /// overloads of operators >> and << in order to handle your
 /// custom types.
@@ -169,6 +169,7 @@ protected:
 private:
 
     friend class SocketSelector;
+    friend class TcpSocketPool;
 
     ////////////////////////////////////////////////////////////
     // Member data
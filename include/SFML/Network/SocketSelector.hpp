@@ -79,11 +79,35 @@ public:
     ////////////////////////////////////////////////////////////
     void add(Socket& socket);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a new socket to the selector, to be notified
+    ///        when it is ready to send
+    ///
+    /// This is mostly useful for TCP sockets that are connecting
+    /// in non-blocking mode: such a socket becomes ready to send
+    /// when its connection request has returned, successfully or
+    /// not (see TcpSocket::finishConnect).
+    /// A socket can be added both with add and addForSending.
+    ///
+    /// This function keeps a weak reference to the socket,
+    /// so you have to make sure that the socket is not destroyed
+    /// while it is stored in the selector.
+    /// This function does nothing if the socket is not valid.
+    ///
+    /// \param socket Reference to the socket to add
+    ///
+    /// \see add, remove, isReadyToSend
+    ///
+    ////////////////////////////////////////////////////////////
+    void addForSending(Socket& socket);
+
     ////////////////////////////////////////////////////////////
     /// \brief Remove a socket from the selector
     ///
     /// This function doesn't destroy the socket, it simply
     /// removes the reference that the selector has to it.
+    /// The socket is removed from both the sockets observed for
+    /// receiving and the sockets observed for sending.
     ///
     /// \param socket Reference to the socket to remove
     ///
@@ -108,8 +132,9 @@ public:
     /// \brief Wait until one or more sockets are ready to receive
     ///
     /// This function returns as soon as at least one socket has
-    /// some data available to be received. To know which sockets are
-    /// ready, use the isReady function.
+    /// some data available to be received, or one of the sockets
+    /// added with addForSending is ready to send. To know which
+    /// sockets are ready, use the isReady and isReadyToSend functions.
     /// If you use a timeout and no socket is ready before the timeout
     /// is over, the function returns false.
     ///
@@ -141,6 +166,23 @@ public:
     ////////////////////////////////////////////////////////////
     bool isReady(Socket& socket) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Test a socket to know if it is ready to send data
+    ///
+    /// This function must be used after a call to Wait, to know
+    /// which of the sockets added with addForSending are ready.
+    /// For a TCP socket connecting in non-blocking mode, it means
+    /// that the result of the connection is available.
+    ///
+    /// \param socket Socket to test
+    ///
+    /// \return True if the socket is ready to send, false otherwise
+    ///
+    /// \see addForSending, isReady
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isReadyToSend(Socket& socket) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
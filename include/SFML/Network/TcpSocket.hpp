@@ -111,6 +111,27 @@ public:
     ////////////////////////////////////////////////////////////
     Status connect(const IpAddress& remoteAddress, unsigned short remotePort, Time timeout = Time::Zero);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the result of a connection started in
+    ///        non-blocking mode
+    ///
+    /// In non-blocking mode, connect returns Socket::NotReady
+    /// immediately while the connection is being established.
+    /// This function can then be called to know whether the
+    /// connection has completed, without blocking. The socket
+    /// becomes ready to send (see SocketSelector::addForSending)
+    /// as soon as the result is known, which allows to wait for
+    /// many connections at once.
+    ///
+    /// \return Socket::Done if the connection is established,
+    ///         Socket::NotReady if it is still in progress, or
+    ///         an error status if it failed
+    ///
+    /// \see connect
+    ///
+    ////////////////////////////////////////////////////////////
+    Status finishConnect();
+
     ////////////////////////////////////////////////////////////
     /// \brief Disconnect the socket from its remote peer
     ///
@@ -311,6 +332,21 @@ private:
 /// socket.send(message.c_str(), message.size() + 1);
 /// \endcode
 ///
-/// \see sf::Socket, sf::UdpSocket, sf::Packet
+/// Connections can also be established asynchronously, by
+/// calling connect on a non-blocking socket and waiting for
+/// the result with a sf::SocketSelector:
+/// \code
+/// socket.setBlocking(false);
+/// socket.connect("192.168.1.50", 55001);
+///
+/// sf::SocketSelector selector;
+/// selector.addForSending(socket);
+/// if (selector.wait(sf::seconds(5)) && (socket.finishConnect() == sf::Socket::Done))
+/// {
+///     // Connected
+/// }
+/// \endcode
+///
+/// \see sf::Socket, sf::UdpSocket, sf::Packet, sf::TcpSocketPool
 ///
 ////////////////////////////////////////////////////////////
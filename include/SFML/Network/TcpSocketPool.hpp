@@ -0,0 +1,214 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_TCPSOCKETPOOL_HPP
+#define SFML_TCPSOCKETPOOL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Time.hpp>
+#include <map>
+#include <utility>
+#include <vector>
+
+
+namespace sf
+{
+class TcpSocket;
+
+////////////////////////////////////////////////////////////
+/// \brief Pool of reusable TCP connections
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API TcpSocketPool : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty pool.
+    ///
+    ////////////////////////////////////////////////////////////
+    TcpSocketPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Closes and destroys all the idle connections of the pool.
+    /// Connections that are currently acquired are not affected.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TcpSocketPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a connection to a remote peer
+    ///
+    /// If the pool contains an idle connection to the given
+    /// address and port, which was not closed by the peer in the
+    /// meantime, it is returned. Otherwise a new connection is
+    /// established.
+    ///
+    /// The returned socket is owned by the caller until it is
+    /// given back with release (or destroyed with delete).
+    ///
+    /// \param remoteAddress Address of the remote peer
+    /// \param remotePort    Port of the remote peer
+    /// \param timeout       Optional maximum time to wait for a new connection
+    ///
+    /// \return Connected socket, or NULL if the connection failed
+    ///
+    /// \see release
+    ///
+    ////////////////////////////////////////////////////////////
+    TcpSocket* acquire(const IpAddress& remoteAddress, unsigned short remotePort, Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a connection back to the pool
+    ///
+    /// The socket becomes idle and may be returned by a later
+    /// call to acquire with the same address and port. If it
+    /// is no longer connected, it is destroyed instead.
+    ///
+    /// \param socket Socket previously returned by acquire
+    ///
+    /// \see acquire
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(TcpSocket* socket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Establish several connections to a remote peer
+    ///        concurrently
+    ///
+    /// All the connections are started at once in non-blocking
+    /// mode, and this function waits until they are all
+    /// established or failed, or until the timeout is over.
+    /// The established connections are added to the pool as idle
+    /// connections, ready to be acquired.
+    ///
+    /// The number of sockets that can be waited for at once is
+    /// limited by the FD_SETSIZE setting of the operating system.
+    ///
+    /// \param remoteAddress Address of the remote peer
+    /// \param remotePort    Port of the remote peer
+    /// \param count         Number of connections to establish
+    /// \param timeout       Maximum time to wait (use Time::Zero for infinity)
+    ///
+    /// \return Number of connections that were established
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t open(const IpAddress& remoteAddress, unsigned short remotePort, std::size_t count, Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of idle connections to a remote peer
+    ///
+    /// \param remoteAddress Address of the remote peer
+    /// \param remotePort    Port of the remote peer
+    ///
+    /// \return Number of idle connections in the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getIdleCount(const IpAddress& remoteAddress, unsigned short remotePort) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Close and destroy all the idle connections
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether an idle connection was closed by
+    ///        the remote peer
+    ///
+    /// \param socket Socket to check
+    ///
+    /// \return True if the connection is closed
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isClosed(TcpSocket& socket);
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    typedef std::pair<IpAddress, unsigned short>   Key;
+    typedef std::map<Key, std::vector<TcpSocket*> > SocketTable;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    SocketTable m_idleSockets; ///< Idle connections, grouped by remote address and port
+};
+
+} // namespace sf
+
+
+#endif // SFML_TCPSOCKETPOOL_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TcpSocketPool
+/// \ingroup network
+///
+/// Establishing a TCP connection requires a round trip with
+/// the remote peer, which is expensive when many short
+/// exchanges are made with the same hosts. sf::TcpSocketPool
+/// keeps connections open once they are no longer needed, so
+/// that they can be reused later instead of connecting again.
+///
+/// Connections are identified by the address and the port of
+/// the remote peer. A connection is taken from the pool with
+/// acquire, which establishes a new one if no idle connection
+/// is available, and given back with release.
+///
+/// The pool can also be filled in advance with the open
+/// function, which establishes many connections concurrently
+/// instead of one after the other.
+///
+/// Usage example:
+/// \code
+/// sf::TcpSocketPool pool;
+///
+/// // Open 100 connections to the server at once
+/// pool.open("192.168.1.50", 55001, 100, sf::seconds(5));
+///
+/// // Later, get a connection, use it and give it back
+/// sf::TcpSocket* socket = pool.acquire("192.168.1.50", 55001);
+/// if (socket)
+/// {
+///     socket->send(packet);
+///     socket->receive(packet);
+///     pool.release(socket);
+/// }
+/// \endcode
+///
+/// \see sf::TcpSocket, sf::SocketSelector
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_CONDITIONVARIABLE_HPP
+#define SFML_CONDITIONVARIABLE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Time.hpp>
+
+
+namespace sf
+{
+namespace priv
+{
+    class ConditionVariableImpl;
+}
+
+class Mutex;
+
+////////////////////////////////////////////////////////////
+/// \brief Lets threads wait until another thread signals
+///        that a condition may have changed
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API ConditionVariable : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ConditionVariable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ConditionVariable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the condition variable is notified
+    ///
+    /// The mutex must be locked exactly once by the calling
+    /// thread. It is released while the thread is waiting,
+    /// and locked again before the function returns.
+    ///
+    /// The function may return without a notification
+    /// (spurious wake-up), so the condition that is waited
+    /// for must always be checked again in a loop.
+    ///
+    /// \param mutex Mutex protecting the condition
+    ///
+    /// \see notifyOne, notifyAll
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait(Mutex& mutex);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the condition variable is notified,
+    ///        or until a timeout expires
+    ///
+    /// This function behaves like wait(Mutex&), except that it
+    /// gives up waiting after \a timeout. The mutex is locked
+    /// again before the function returns in both cases.
+    ///
+    /// \param mutex   Mutex protecting the condition
+    /// \param timeout Maximum time to wait
+    ///
+    /// \return False if the timeout expired, true otherwise
+    ///
+    /// \see notifyOne, notifyAll
+    ///
+    ////////////////////////////////////////////////////////////
+    bool wait(Mutex& mutex, Time timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wake up one of the threads waiting on the
+    ///        condition variable
+    ///
+    /// \see notifyAll, wait
+    ///
+    ////////////////////////////////////////////////////////////
+    void notifyOne();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wake up all the threads waiting on the
+    ///        condition variable
+    ///
+    /// \see notifyOne, wait
+    ///
+    ////////////////////////////////////////////////////////////
+    void notifyAll();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    priv::ConditionVariableImpl* m_conditionImpl; ///< OS-specific implementation
+};
+
+} // namespace sf
+
+
+#endif // SFML_CONDITIONVARIABLE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ConditionVariable
+/// \ingroup system
+///
+/// A condition variable lets a thread sleep until another
+/// thread tells it that the data it is interested in has
+/// changed, instead of checking that data periodically.
+///
+/// It is always used together with a sf::Mutex protecting
+/// the shared data: the waiting thread locks the mutex,
+/// checks the condition and calls wait(), which releases the
+/// mutex while sleeping. The notifying thread modifies the
+/// data while holding the same mutex, and then calls
+/// notifyOne() or notifyAll().
+///
+/// Usage example:
+/// \code
+/// std::deque<Job> jobs;
+/// sf::Mutex mutex;
+/// sf::ConditionVariable jobAvailable;
+///
+/// void producer()
+/// {
+///     sf::Lock lock(mutex);
+///     jobs.push_back(Job());
+///     jobAvailable.notifyOne();
+/// }
+///
+/// void consumer()
+/// {
+///     sf::Lock lock(mutex);
+///
+///     // wait() may return spuriously, always check the condition again
+///     while (jobs.empty())
+///         jobAvailable.wait(mutex);
+///
+///     Job job = jobs.front();
+///     jobs.pop_front();
+/// }
+/// \endcode
+///
+/// Since SFML mutexes are recursive, be careful to not call
+/// wait() with a mutex that the thread has locked more than
+/// once: only one level would be released, and the threads
+/// that need the mutex to notify would be blocked forever.
+///
+/// \see sf::Mutex, sf::Semaphore
+///
+////////////////////////////////////////////////////////////
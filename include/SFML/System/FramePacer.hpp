@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_FRAMEPACER_HPP
+#define SFML_FRAMEPACER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+#include <SFML/System/Time.hpp>
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Utility class that paces a loop at a fixed period
+///        and measures the achieved frame times
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API FramePacer
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The pacer is created with no target frame time, which
+    /// means that wait() returns immediately.
+    ///
+    ////////////////////////////////////////////////////////////
+    FramePacer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the target duration of a frame
+    ///
+    /// Setting the frame time restarts the schedule, the first
+    /// frame ends one frame time after this call.
+    ///
+    /// \param frameTime Target frame time, or sf::Time::Zero to disable pacing
+    ///
+    /// \see getFrameTime
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFrameTime(Time frameTime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the target duration of a frame
+    ///
+    /// \return Target frame time, or sf::Time::Zero if pacing is disabled
+    ///
+    /// \see setFrameTime
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getFrameTime() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the end of the current frame
+    ///
+    /// Frames end on a fixed schedule: each deadline is exactly
+    /// one frame time after the previous one, so that a frame
+    /// which ends late is compensated by a shorter next frame
+    /// instead of shifting all the following ones. If the loop
+    /// falls behind by more than a whole frame (after a loading
+    /// screen, for example), the schedule restarts from the
+    /// current time rather than rushing to catch up.
+    ///
+    /// The function sleeps until shortly before the deadline,
+    /// then spins for the last fraction of a millisecond, which
+    /// is more accurate than relying on the scheduler alone.
+    ///
+    /// Whether pacing is enabled or not, the time elapsed since
+    /// the previous call is recorded in the statistics.
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the average duration of the recent frames
+    ///
+    /// \return Mean of the recorded frame times, or sf::Time::Zero if none was recorded
+    ///
+    /// \see getFrameTimePercentile, resetStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getAverageFrameTime() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a percentile of the duration of the recent frames
+    ///
+    /// For example, getFrameTimePercentile(99) returns a frame
+    /// time which is greater than or equal to 99% of the
+    /// recorded frame times.
+    ///
+    /// \param percentile Percentile to compute, in range [0, 100]
+    ///
+    /// \return Percentile of the recorded frame times, or sf::Time::Zero if none was recorded
+    ///
+    /// \see getAverageFrameTime, resetStatistics
+    ///
+    ////////////////////////////////////////////////////////////
+    Time getFrameTimePercentile(float percentile) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget all the recorded frame times
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Constants
+    ////////////////////////////////////////////////////////////
+    enum
+    {
+        SampleCount = 256 ///< Number of recent frame times kept for the statistics
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Time        m_frameTime;            ///< Target duration of a frame
+    Time        m_deadline;             ///< Time at which the current frame ends
+    Time        m_lastFrame;            ///< Time at which the previous frame ended
+    Time        m_samples[SampleCount]; ///< Ring buffer of the recent frame times
+    std::size_t m_sampleCount;          ///< Number of valid samples
+    std::size_t m_nextSample;           ///< Index of the next sample to write
+};
+
+} // namespace sf
+
+
+#endif // SFML_FRAMEPACER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FramePacer
+/// \ingroup system
+///
+/// sf::FramePacer keeps a loop running at a fixed rate, and
+/// keeps track of how long the recent frames actually took.
+/// sf::Window uses it to implement setFramerateLimit, but it
+/// can be used on its own as well, for example to run a
+/// server simulation at a fixed tick rate.
+///
+/// Usage example:
+/// \code
+/// sf::FramePacer pacer;
+/// pacer.setFrameTime(sf::seconds(1.f / 60.f));
+///
+/// while (running)
+/// {
+///     update();
+///     pacer.wait();
+/// }
+///
+/// std::cout << "mean: " << pacer.getAverageFrameTime().asMilliseconds() << " ms, "
+///           << "p99: " << pacer.getFrameTimePercentile(99).asMilliseconds() << " ms" << std::endl;
+/// \endcode
+///
+/// \see sf::Clock, sf::sleep
+///
+////////////////////////////////////////////////////////////
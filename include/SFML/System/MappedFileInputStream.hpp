@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_MAPPEDFILEINPUTSTREAM_HPP
+#define SFML_MAPPEDFILEINPUTSTREAM_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+#include <SFML/System/Export.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <string>
+
+
+namespace sf
+{
+namespace priv
+{
+    class MappedFileImpl;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Implementation of input stream based on a
+///        memory-mapped file
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API MappedFileInputStream : public InputStream, NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~MappedFileInputStream();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the stream from a file path
+    ///
+    /// The whole file is mapped into the address space of the
+    /// process; its pages are loaded by the system when they
+    /// are accessed.
+    ///
+    /// \param filename Name of the file to open
+    ///
+    /// \return True on success, false on error
+    ///
+    ////////////////////////////////////////////////////////////
+    bool open(const std::string& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the contents of the file
+    ///
+    /// The contents can be parsed in place, without copying
+    /// them. The pointer stays valid until the stream is
+    /// destroyed or another file is opened.
+    ///
+    /// \return Pointer to the contents of the file, or NULL if the file is empty or not open
+    ///
+    ////////////////////////////////////////////////////////////
+    const void* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// After reading, the stream's reading position must be
+    /// advanced by the amount of bytes read.
+    ///
+    /// \param data Buffer where to copy the read data
+    /// \param size Desired number of bytes to read
+    ///
+    /// \return The number of bytes actually read, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Int64 read(void* data, Int64 size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current reading position
+    ///
+    /// \param position The position to seek to, from the beginning
+    ///
+    /// \return The position actually sought to, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Int64 seek(Int64 position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the stream
+    ///
+    /// \return The current position, or -1 on error.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Int64 tell();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the stream
+    ///
+    /// \return The total number of bytes available in the stream, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Int64 getSize();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    priv::MappedFileImpl* m_impl;   ///< OS-specific implementation, NULL if no file is open
+    Int64                 m_offset; ///< Current reading position in the file
+};
+
+} // namespace sf
+
+
+#endif // SFML_MAPPEDFILEINPUTSTREAM_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MappedFileInputStream
+/// \ingroup system
+///
+/// This class is a specialization of InputStream that
+/// reads from a file on disk, like sf::FileInputStream, but
+/// maps the file into memory instead of reading it through
+/// the C standard library.
+///
+/// Reading from the stream is a simple copy from the mapped
+/// memory, and seeking doesn't involve the system at all.
+/// Moreover, the getData function gives a direct access to
+/// the contents of the file, so that they can be parsed in
+/// place without any copy.
+///
+/// SFML uses this class internally to load images, fonts and
+/// sound files from files. Files that can't be mapped, such
+/// as the assets of an Android package, must be read with
+/// sf::FileInputStream instead.
+///
+/// Usage example:
+/// \code
+/// void process(const void* data, std::size_t size);
+///
+/// sf::MappedFileInputStream stream;
+/// if (stream.open("some_file.dat"))
+///    process(stream.getData(), stream.getSize());
+/// \endcode
+///
+/// InputStream, FileInputStream, MemoryInputStream
+///
+////////////////////////////////////////////////////////////
@@ -82,6 +82,8 @@ public:
 
 private:
 
+    friend class ConditionVariable;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -143,6 +145,6 @@ private:
 /// However, you must call unlock() exactly as many times as you
 /// called lock(). If you don't, the mutex won't be released.
 ///
-/// \see sf::Lock
+/// \see sf::Lock, sf::ConditionVariable
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_PACKARCHIVE_HPP
+#define SFML_PACKARCHIVE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+#include <SFML/System/Export.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+class PackInputStream;
+
+////////////////////////////////////////////////////////////
+/// \brief Read-only archive that stores many files in a
+///        single memory-mapped pack
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API PackArchive : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PackArchive();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a pack archive
+    ///
+    /// The file is mapped into memory and its table of contents
+    /// is validated; the contents of the entries are not read
+    /// until they are opened with a sf::PackInputStream.
+    ///
+    /// \param filename Path of the pack file
+    ///
+    /// \return True on success, false on error
+    ///
+    /// \see sf::PackWriter
+    ///
+    ////////////////////////////////////////////////////////////
+    bool open(const std::string& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the archive contains an entry
+    ///
+    /// \param name Name of the entry
+    ///
+    /// \return True if the entry exists, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    bool contains(const std::string& name) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of entries in the archive
+    ///
+    /// \return Number of entries
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getEntryCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the name of an entry
+    ///
+    /// Entries are sorted by name.
+    ///
+    /// \param index Index of the entry, in range [0, getEntryCount() - 1]
+    ///
+    /// \return Name of the entry
+    ///
+    ////////////////////////////////////////////////////////////
+    std::string getEntryName(std::size_t index) const;
+
+private:
+
+    friend class PackInputStream;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Entry of the table of contents
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        const char* name;       ///< Name of the entry, inside the mapping
+        std::size_t nameLength; ///< Length of the name
+        const Uint8* data;      ///< Stored contents of the entry, inside the mapping
+        std::size_t storedSize; ///< Size of the stored contents, in bytes
+        std::size_t size;       ///< Size of the decompressed contents, in bytes
+        Uint32      method;     ///< Compression method
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find an entry by name
+    ///
+    /// \param name Name of the entry
+    ///
+    /// \return Pointer to the entry, or NULL if not found
+    ///
+    ////////////////////////////////////////////////////////////
+    const Entry* find(const std::string& name) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream m_file;    ///< Mapping of the pack file
+    std::vector<Entry>    m_entries; ///< Table of contents, sorted by name
+};
+
+} // namespace sf
+
+
+#endif // SFML_PACKARCHIVE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PackArchive
+/// \ingroup system
+///
+/// sf::PackArchive gives access to a pack file, which gathers
+/// many small files into a single big one. Opening an archive
+/// maps it into memory and reads its table of contents once;
+/// after that, opening an entry is a binary search in memory
+/// and involves no system call at all. This makes it much
+/// faster than opening thousands of separate files on disk,
+/// especially when the cache is cold.
+///
+/// Entries are read with sf::PackInputStream, which is a
+/// regular sf::InputStream, so every loadFromStream function
+/// of SFML works with them unchanged. Entries can be stored
+/// raw, in which case they are read directly from the
+/// mapping, or compressed with LZ4, in which case they are
+/// decompressed in memory when they are opened.
+///
+/// Pack files are created with sf::PackWriter.
+///
+/// Usage example:
+/// \code
+/// sf::PackArchive archive;
+/// if (!archive.open("data.pack"))
+///     return -1;
+///
+/// sf::PackInputStream stream;
+/// if (!stream.open(archive, "images/hero.png"))
+///     return -1;
+///
+/// sf::Texture texture;
+/// texture.loadFromStream(stream);
+/// \endcode
+///
+/// \see sf::PackInputStream, sf::PackWriter
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_PACKINPUTSTREAM_HPP
+#define SFML_PACKINPUTSTREAM_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+#include <SFML/System/Export.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/MemoryInputStream.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+class PackArchive;
+
+////////////////////////////////////////////////////////////
+/// \brief Implementation of input stream based on an entry
+///        of a pack archive
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API PackInputStream : public InputStream, NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PackInputStream();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the stream from an entry of a pack archive
+    ///
+    /// Raw entries are read directly from the archive, so the
+    /// archive must remain alive as long as the stream is used.
+    /// Compressed entries are decompressed into memory owned by
+    /// the stream.
+    ///
+    /// \param archive Pack archive that contains the entry
+    /// \param name    Name of the entry
+    ///
+    /// \return True on success, false on error
+    ///
+    ////////////////////////////////////////////////////////////
+    bool open(const PackArchive& archive, const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// After reading, the stream's reading position must be
+    /// advanced by the amount of bytes read.
+    ///
+    /// \param data Buffer where to copy the read data
+    /// \param size Desired number of bytes to read
+    ///
+    /// \return The number of bytes actually read, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Int64 read(void* data, Int64 size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current reading position
+    ///
+    /// \param position The position to seek to, from the beginning
+    ///
+    /// \return The position actually sought to, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Int64 seek(Int64 position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the stream
+    ///
+    /// \return The current position, or -1 on error.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Int64 tell();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the stream
+    ///
+    /// \return The total number of bytes available in the stream, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual Int64 getSize();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    MemoryInputStream  m_stream; ///< Stream over the contents of the entry
+    std::vector<Uint8> m_buffer; ///< Decompressed contents of compressed entries
+};
+
+} // namespace sf
+
+
+#endif // SFML_PACKINPUTSTREAM_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PackInputStream
+/// \ingroup system
+///
+/// This class is a specialization of InputStream that
+/// reads from an entry of a sf::PackArchive.
+///
+/// It can be passed to any loadFromStream function of SFML,
+/// so that textures, fonts, sounds or shaders can be loaded
+/// from a pack archive exactly like they are loaded from
+/// separate files.
+///
+/// Usage example:
+/// \code
+/// sf::PackArchive archive;
+/// archive.open("data.pack");
+///
+/// sf::PackInputStream stream;
+/// if (stream.open(archive, "sounds/jump.ogg"))
+/// {
+///     sf::SoundBuffer buffer;
+///     buffer.loadFromStream(stream);
+/// }
+/// \endcode
+///
+/// \see sf::PackArchive, sf::PackWriter
+///
+////////////////////////////////////////////////////////////
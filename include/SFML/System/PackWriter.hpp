@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_PACKWRITER_HPP
+#define SFML_PACKWRITER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Utility class to build pack archives
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API PackWriter : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PackWriter();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a file on disk to the archive
+    ///
+    /// The file is not read until the archive is saved.
+    ///
+    /// \param name     Name of the entry in the archive
+    /// \param filename Path of the file to add
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const std::string& name, const std::string& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a block of memory to the archive
+    ///
+    /// The data is copied, so it can be destroyed right after
+    /// this function returns.
+    ///
+    /// \param name Name of the entry in the archive
+    /// \param data Pointer to the contents of the entry
+    /// \param size Size of the contents, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const std::string& name, const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of entries added so far
+    ///
+    /// \return Number of entries
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t getEntryCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the entries
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the archive to a file
+    ///
+    /// When compression is enabled, each entry is compressed
+    /// with LZ4 and stored compressed only if it gets smaller;
+    /// already compressed formats (PNG, OGG, ...) are therefore
+    /// stored raw and can still be read without any copy.
+    ///
+    /// This function fails if two entries have the same name
+    /// or if a file can't be read.
+    ///
+    /// \param filename Path of the pack file to write
+    /// \param compress True to compress the entries
+    ///
+    /// \return True if saving was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool save(const std::string& filename, bool compress = true) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Entry waiting to be written
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::string       name;     ///< Name of the entry
+        std::string       filename; ///< Path of the file to read, if not added from memory
+        std::vector<char> data;     ///< Contents of the entry, if added from memory
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Entry> m_entries; ///< Entries to write
+};
+
+} // namespace sf
+
+
+#endif // SFML_PACKWRITER_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PackWriter
+/// \ingroup system
+///
+/// sf::PackWriter creates the pack files that are read by
+/// sf::PackArchive. It is meant to be used by asset build
+/// tools rather than by games themselves.
+///
+/// Entries are identified by their name, which is an
+/// arbitrary string; using paths relative to the asset root,
+/// with forward slashes, is the most natural choice.
+///
+/// Usage example:
+/// \code
+/// sf::PackWriter writer;
+/// writer.add("images/hero.png", "assets/images/hero.png");
+/// writer.add("shaders/blur.frag", "assets/shaders/blur.frag");
+/// writer.add("levels/1.txt", levelText.data(), levelText.size());
+///
+/// if (!writer.save("data.pack"))
+///     return -1;
+/// \endcode
+///
+/// \see sf::PackArchive, sf::PackInputStream
+///
+////////////////////////////////////////////////////////////
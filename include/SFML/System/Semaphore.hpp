@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SEMAPHORE_HPP
+#define SFML_SEMAPHORE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+#include <SFML/System/ConditionVariable.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Counter that threads can wait on until it
+///        becomes positive
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API Semaphore : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the semaphore with an initial count
+    ///
+    /// \param count Initial number of available units
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Semaphore(unsigned int count = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take one unit from the semaphore
+    ///
+    /// If the count is zero, this call blocks until another
+    /// thread calls release().
+    ///
+    /// \see tryAcquire, release
+    ///
+    ////////////////////////////////////////////////////////////
+    void acquire();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take one unit from the semaphore, waiting
+    ///        at most \a timeout for one to be available
+    ///
+    /// \param timeout Maximum time to wait
+    ///
+    /// \return True if a unit was taken, false if the timeout expired
+    ///
+    /// \see tryAcquire, release
+    ///
+    ////////////////////////////////////////////////////////////
+    bool acquire(Time timeout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take one unit from the semaphore if one is
+    ///        available, without blocking
+    ///
+    /// \return True if a unit was taken, false otherwise
+    ///
+    /// \see acquire, release
+    ///
+    ////////////////////////////////////////////////////////////
+    bool tryAcquire();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give units back to the semaphore
+    ///
+    /// Up to \a count threads blocked in acquire() are woken up.
+    ///
+    /// \param count Number of units to add
+    ///
+    /// \see acquire
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(unsigned int count = 1);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Mutex             m_mutex;     ///< Mutex protecting the count
+    ConditionVariable m_available; ///< Signaled when units are released
+    unsigned int      m_count;     ///< Number of available units
+};
+
+} // namespace sf
+
+
+#endif // SFML_SEMAPHORE_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Semaphore
+/// \ingroup system
+///
+/// A semaphore holds a number of units that threads can take
+/// with acquire() and give back with release(). When no unit
+/// is available, acquire() blocks until another thread
+/// releases one.
+///
+/// Semaphores are typically used to limit the number of threads
+/// using a resource at the same time, or to count items that
+/// are produced by one thread and consumed by another one.
+///
+/// Usage example:
+/// \code
+/// sf::Semaphore slots(4); // at most 4 concurrent downloads
+///
+/// void download(const std::string& url)
+/// {
+///     slots.acquire();
+///     ...
+///     slots.release();
+/// }
+/// \endcode
+///
+/// Unlike sf::Mutex, a semaphore is not owned by a thread:
+/// a unit can be released by a different thread than the one
+/// that acquired it.
+///
+/// \see sf::Mutex, sf::ConditionVariable
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SHAREDMUTEX_HPP
+#define SFML_SHAREDMUTEX_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+
+namespace sf
+{
+namespace priv
+{
+    class SharedMutexImpl;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Mutex that can be locked either by a single
+///        writer or by several readers at the same time
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API SharedMutex : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SharedMutex();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SharedMutex();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Lock the mutex for exclusive access
+    ///
+    /// This call blocks until no other thread holds the mutex,
+    /// neither exclusively nor shared.
+    ///
+    /// \see unlock, lockShared
+    ///
+    ////////////////////////////////////////////////////////////
+    void lock();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release an exclusive lock
+    ///
+    /// \see lock
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlock();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Lock the mutex for shared access
+    ///
+    /// This call blocks only while another thread holds the
+    /// mutex exclusively.
+    ///
+    /// \see unlockShared, lock
+    ///
+    ////////////////////////////////////////////////////////////
+    void lockShared();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release a shared lock
+    ///
+    /// \see lockShared
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlockShared();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    priv::SharedMutexImpl* m_mutexImpl; ///< OS-specific implementation
+};
+
+} // namespace sf
+
+
+#endif // SFML_SHAREDMUTEX_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SharedMutex
+/// \ingroup system
+///
+/// sf::SharedMutex protects data that is read often and
+/// modified rarely. Any number of threads can hold it in
+/// shared mode with lockShared() and read the data at the
+/// same time, while a thread that wants to modify the data
+/// takes it in exclusive mode with lock(), which waits for
+/// all the readers to leave.
+///
+/// Usage example:
+/// \code
+/// std::map<std::string, sf::Texture*> textures;
+/// sf::SharedMutex mutex;
+///
+/// sf::Texture* find(const std::string& name)
+/// {
+///     mutex.lockShared();
+///     std::map<std::string, sf::Texture*>::iterator it = textures.find(name);
+///     sf::Texture* texture = (it != textures.end()) ? it->second : NULL;
+///     mutex.unlockShared();
+///     return texture;
+/// }
+///
+/// void insert(const std::string& name, sf::Texture* texture)
+/// {
+///     mutex.lock();
+///     textures[name] = texture;
+///     mutex.unlock();
+/// }
+/// \endcode
+///
+/// Unlike sf::Mutex, sf::SharedMutex is not recursive: a thread
+/// must not lock it again, in any mode, while it already holds it.
+///
+/// \see sf::Mutex
+///
+////////////////////////////////////////////////////////////
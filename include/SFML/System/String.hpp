@@ -160,6 +160,11 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Create a new sf::String from a UTF-8 encoded string
     ///
+    /// Sequences stored contiguously in memory (pointers to char
+    /// or sf::Uint8, and std::string iterators) are converted by
+    /// an optimized function, which processes runs of ASCII
+    /// characters several at a time.
+    ///
     /// \param begin Forward iterator to the beginning of the UTF-8 sequence
     /// \param end   Forward iterator to the end of the UTF-8 sequence
     ///
@@ -354,6 +359,19 @@ public:
     ////////////////////////////////////////////////////////////
     void clear();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Exchange the contents of the string with another one
+    ///
+    /// This function doesn't copy nor allocate anything, it
+    /// only exchanges the internal buffers of the two strings.
+    /// It can be used to hand a string over to another object
+    /// without copying it, and to recycle buffers across calls.
+    ///
+    /// \param right String to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(String& right);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the size of the string
     ///
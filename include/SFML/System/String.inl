@@ -33,6 +33,17 @@ String String::fromUtf8(T begin, T end)
 }
 
 
+////////////////////////////////////////////////////////////
+// Contiguous UTF-8 sequences are converted by optimized functions
+////////////////////////////////////////////////////////////
+template <> SFML_SYSTEM_API String String::fromUtf8(const char* begin, const char* end);
+template <> SFML_SYSTEM_API String String::fromUtf8(char* begin, char* end);
+template <> SFML_SYSTEM_API String String::fromUtf8(const Uint8* begin, const Uint8* end);
+template <> SFML_SYSTEM_API String String::fromUtf8(Uint8* begin, Uint8* end);
+template <> SFML_SYSTEM_API String String::fromUtf8(std::string::const_iterator begin, std::string::const_iterator end);
+template <> SFML_SYSTEM_API String String::fromUtf8(std::string::iterator begin, std::string::iterator end);
+
+
 ////////////////////////////////////////////////////////////
 template <typename T>
 String String::fromUtf16(T begin, T end)
@@ -0,0 +1,456 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_THREADPOOL_HPP
+#define SFML_THREADPOOL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+#include <SFML/System/ConditionVariable.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Thread.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+    class TaskState;
+    class ThreadPoolWorker;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Handle to a task submitted to a sf::ThreadPool
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API Task
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty handle, which doesn't refer to any task.
+    /// An empty task is always considered done.
+    ///
+    ////////////////////////////////////////////////////////////
+    Task();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy Handle to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    Task(const Task& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Destroying a handle doesn't cancel the task.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Task();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Handle to copy
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    Task& operator =(const Task& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the task has finished running
+    ///
+    /// \return True if the task is finished, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isDone() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until the task has finished running
+    ///
+    /// When called from a task of the same pool, the calling
+    /// worker runs other pending tasks while it waits, so that
+    /// tasks waiting for each other can't exhaust the pool.
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Schedule a function to run after this task
+    ///
+    /// The continuation is submitted to the same pool, with the
+    /// same priority, as soon as this task has finished.
+    /// This function must not be called on an empty handle.
+    ///
+    /// \param function Functor or free function to run
+    ///
+    /// \return Handle to the continuation
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F>
+    Task then(F function);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Schedule a function taking an argument to run
+    ///        after this task
+    ///
+    /// \param function Functor or free function to run
+    /// \param argument Argument to pass to the function
+    ///
+    /// \return Handle to the continuation
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F, typename A>
+    Task then(F function, A argument);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Schedule a member function to run after this task
+    ///
+    /// \param function Member function to run
+    /// \param object   Object to call the member function on
+    ///
+    /// \return Handle to the continuation
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename C>
+    Task then(void(C::*function)(), C* object);
+
+private:
+
+    friend class ThreadPool;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the handle from a task state
+    ///
+    /// The handle takes over one reference of the state.
+    ///
+    /// \param state Shared state of the task
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Task(priv::TaskState* state);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Schedule an abstract function to run after this task
+    ///
+    /// \param function Function to run, owned by the new task
+    ///
+    /// \return Handle to the continuation
+    ///
+    ////////////////////////////////////////////////////////////
+    Task thenTask(priv::ThreadFunc* function);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    priv::TaskState* m_state; ///< Shared state of the task, NULL if empty
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Set of worker threads running submitted tasks
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API ThreadPool : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Priorities of the tasks
+    ///
+    ////////////////////////////////////////////////////////////
+    enum Priority
+    {
+        Low,    ///< Runs when no other task is pending
+        Normal, ///< Default priority
+        High    ///< Runs before the other pending tasks
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates one worker thread per logical processor.
+    ///
+    /// \see getHardwareConcurrency
+    ///
+    ////////////////////////////////////////////////////////////
+    ThreadPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the pool with a given number of threads
+    ///
+    /// \param threadCount Number of worker threads (at least 1)
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ThreadPool(unsigned int threadCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for all the submitted tasks to finish, then
+    /// stops the worker threads.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ThreadPool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit a functor or a free function
+    ///
+    /// \param function Functor or free function to run
+    /// \param priority Priority of the task
+    ///
+    /// \return Handle to the task
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F>
+    Task submit(F function, Priority priority = Normal);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit a functor or a free function taking an argument
+    ///
+    /// \param function Functor or free function to run
+    /// \param argument Argument to pass to the function
+    /// \param priority Priority of the task
+    ///
+    /// \return Handle to the task
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F, typename A>
+    Task submit(F function, A argument, Priority priority = Normal);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit a member function
+    ///
+    /// \param function Member function to run
+    /// \param object   Object to call the member function on
+    /// \param priority Priority of the task
+    ///
+    /// \return Handle to the task
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename C>
+    Task submit(void(C::*function)(), C* object, Priority priority = Normal);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call a function for each index of a range,
+    ///        in parallel
+    ///
+    /// \a function is called as function(i) for every i in
+    /// [begin, end), concurrently from several threads. The
+    /// calling thread takes part in the work, and the function
+    /// returns when all the indices have been processed.
+    ///
+    /// \param begin    First index of the range
+    /// \param end      Index past the last one of the range
+    /// \param function Functor or free function to call
+    /// \param priority Priority of the tasks
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F>
+    void parallelFor(std::size_t begin, std::size_t end, F function, Priority priority = Normal);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until all the submitted tasks have finished
+    ///
+    /// This function must not be called from a task of the pool.
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads
+    ///
+    /// \return Number of worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads that the hardware can
+    ///        run concurrently
+    ///
+    /// \return Number of logical processors, at least 1
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned int getHardwareConcurrency();
+
+private:
+
+    friend class Task;
+    friend class priv::ThreadPoolWorker;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the worker threads
+    ///
+    /// \param threadCount Number of worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    void initialize(unsigned int threadCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit an abstract function
+    ///
+    /// \param function Function to run, owned by the new task
+    /// \param priority Priority of the task
+    ///
+    /// \return Handle to the task
+    ///
+    ////////////////////////////////////////////////////////////
+    Task submitTask(priv::ThreadFunc* function, Priority priority);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Put a task in the queue of a worker
+    ///
+    /// \param state Task to queue
+    ///
+    ////////////////////////////////////////////////////////////
+    void enqueue(priv::TaskState* state);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a task from the queues
+    ///
+    /// A pending task must have been reserved by the caller
+    /// before calling this function.
+    ///
+    /// \param worker Worker looking for a task, its own queue
+    ///               is searched first
+    ///
+    /// \return Task to run
+    ///
+    ////////////////////////////////////////////////////////////
+    priv::TaskState* takeTask(priv::ThreadPoolWorker& worker);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run a task, and schedule its continuations
+    ///
+    /// \param state Task to run
+    ///
+    ////////////////////////////////////////////////////////////
+    void runTask(priv::TaskState* state);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run one pending task, if there is any
+    ///
+    /// \param worker Worker calling this function
+    ///
+    /// \return True if a task was run, false if none was pending
+    ///
+    ////////////////////////////////////////////////////////////
+    bool runPendingTask(priv::ThreadPoolWorker& worker);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Main loop of the worker threads
+    ///
+    /// \param worker Worker running the loop
+    ///
+    ////////////////////////////////////////////////////////////
+    void runWorker(priv::ThreadPoolWorker& worker);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<priv::ThreadPoolWorker*> m_workers;         ///< Worker threads and their queues
+    Mutex                                m_mutex;           ///< Mutex protecting the counters below
+    ConditionVariable                    m_taskAvailable;   ///< Signaled when a task is queued or the pool stops
+    ConditionVariable                    m_allFinished;     ///< Signaled when the last unfinished task finishes
+    unsigned int                         m_pendingCount;    ///< Number of queued tasks not yet reserved by a thread
+    unsigned int                         m_unfinishedCount; ///< Number of submitted tasks not finished yet
+    unsigned int                         m_nextWorker;      ///< Worker receiving the next task submitted from outside the pool
+    bool                                 m_isStopping;      ///< Tells the workers to exit when there's nothing left to do
+};
+
+#include <SFML/System/ThreadPool.inl>
+
+} // namespace sf
+
+
+#endif // SFML_THREADPOOL_HPP
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ThreadPool
+/// \ingroup system
+///
+/// sf::ThreadPool keeps a set of threads alive and runs the
+/// tasks submitted to it on these threads. This avoids
+/// creating and destroying a sf::Thread for every piece of
+/// work, and spreads the work over all the processors.
+///
+/// Like sf::Thread, the pool accepts free functions, functors
+/// and member functions, with an optional argument. submit()
+/// returns a sf::Task handle, which can be used to wait for
+/// the task or to chain another function after it with
+/// sf::Task::then.
+///
+/// Each worker has its own queue: tasks submitted from
+/// outside the pool are distributed among the queues, tasks
+/// submitted from a task go to the queue of the current
+/// worker, and idle workers steal tasks from the queues of
+/// the busy ones. Tasks with a higher priority are always
+/// taken before tasks with a lower one.
+///
+/// Usage example:
+/// \code
+/// void loadImage(sf::Image* image)
+/// {
+///     image->loadFromFile("image.png");
+/// }
+///
+/// sf::ThreadPool pool;
+///
+/// // Load several images in parallel
+/// std::vector<sf::Image> images(10);
+/// for (std::size_t i = 0; i < images.size(); ++i)
+///     pool.submit(&loadImage, &images[i]);
+///
+/// // Do something else, with a higher priority
+/// sf::Task task = pool.submit(&decodeMusic, sf::ThreadPool::High);
+/// task.then(&playMusic);
+///
+/// // Process all the pixels of a large array, in parallel
+/// pool.parallelFor(0, pixels.size(), Brighten(pixels));
+///
+/// // Wait for everything to finish
+/// pool.wait();
+/// \endcode
+///
+/// Tasks run concurrently: all the data that they share
+/// must be protected, for example with a sf::Mutex. Resources
+/// that need an OpenGL context, such as sf::Texture, must not
+/// be created in tasks; load a sf::Image in the task instead,
+/// and upload it to a texture in the main thread.
+///
+/// \see sf::Thread, sf::Task
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+namespace priv
+{
+// Shared state of a parallel loop, from which the tasks claim blocks of indices
+template <typename F>
+class ParallelForRange : NonCopyable
+{
+public:
+
+    ParallelForRange(std::size_t begin, std::size_t end, std::size_t blockSize, F function) :
+    m_next     (begin),
+    m_end      (end),
+    m_blockSize(blockSize),
+    m_function (function)
+    {
+    }
+
+    void run()
+    {
+        for (;;)
+        {
+            std::size_t first;
+            std::size_t last;
+
+            {
+                Lock lock(m_mutex);
+
+                if (m_next >= m_end)
+                    return;
+
+                first = m_next;
+                last = first + std::min(m_blockSize, m_end - first);
+                m_next = last;
+            }
+
+            for (std::size_t i = first; i < last; ++i)
+                m_function(i);
+        }
+    }
+
+private:
+
+    Mutex       m_mutex;
+    std::size_t m_next;
+    std::size_t m_end;
+    std::size_t m_blockSize;
+    F           m_function;
+};
+
+} // namespace priv
+
+
+////////////////////////////////////////////////////////////
+template <typename F>
+Task Task::then(F function)
+{
+    return thenTask(new priv::ThreadFunctor<F>(function));
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename F, typename A>
+Task Task::then(F function, A argument)
+{
+    return thenTask(new priv::ThreadFunctorWithArg<F, A>(function, argument));
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename C>
+Task Task::then(void(C::*function)(), C* object)
+{
+    return thenTask(new priv::ThreadMemberFunc<C>(function, object));
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename F>
+Task ThreadPool::submit(F function, Priority priority)
+{
+    return submitTask(new priv::ThreadFunctor<F>(function), priority);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename F, typename A>
+Task ThreadPool::submit(F function, A argument, Priority priority)
+{
+    return submitTask(new priv::ThreadFunctorWithArg<F, A>(function, argument), priority);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename C>
+Task ThreadPool::submit(void(C::*function)(), C* object, Priority priority)
+{
+    return submitTask(new priv::ThreadMemberFunc<C>(function, object), priority);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename F>
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end, F function, Priority priority)
+{
+    if (begin >= end)
+        return;
+
+    // Cut the range into a few blocks per thread, so that threads
+    // finishing early can help with the remaining blocks
+    std::size_t count = end - begin;
+    std::size_t threadCount = getThreadCount();
+    std::size_t blockSize = std::max(count / (threadCount * 4), static_cast<std::size_t>(1));
+    std::size_t blockCount = (count + blockSize - 1) / blockSize;
+
+    priv::ParallelForRange<F> range(begin, end, blockSize, function);
+
+    // The calling thread works on the range too, so it needs one helper less
+    std::vector<Task> tasks;
+    std::size_t taskCount = std::min(threadCount, blockCount - 1);
+    tasks.reserve(taskCount);
+    for (std::size_t i = 0; i < taskCount; ++i)
+        tasks.push_back(submit(&priv::ParallelForRange<F>::run, &range, priority));
+
+    range.run();
+
+    // The range must stay alive until all the tasks are done with it
+    for (std::size_t i = 0; i < tasks.size(); ++i)
+        tasks[i].wait();
+}
@@ -36,6 +36,7 @@
 #include <SFML/Window/WindowHandle.hpp>
 #include <SFML/Window/WindowStyle.hpp>
 #include <SFML/System/Clock.hpp>
+#include <SFML/System/FramePacer.hpp>
 #include <SFML/System/NonCopyable.hpp>
 #include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
@@ -401,17 +402,37 @@ public:
     /// If a limit is set, the window will use a small delay after
     /// each call to display() to ensure that the current frame
     /// lasted long enough to match the framerate limit.
-    /// SFML will try to match the given limit as much as it can,
-    /// but since it internally uses sf::sleep, whose precision
-    /// depends on the underlying OS, the results may be a little
-    /// unprecise as well (for example, you can get 65 FPS when
-    /// requesting 60).
+    /// Frames are paced on a fixed schedule by a sf::FramePacer,
+    /// which sleeps until shortly before the end of the frame
+    /// and spins for the remaining time, so the achieved
+    /// framerate closely matches the requested one.
     ///
     /// \param limit Framerate limit, in frames per seconds (use 0 to disable limit)
     ///
+    /// \see getFramePacer
+    ///
     ////////////////////////////////////////////////////////////
     void setFramerateLimit(unsigned int limit);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the frame pacer of the window
+    ///
+    /// The frame pacer records the time elapsed between
+    /// consecutive calls to display(), whether a framerate
+    /// limit is set or not, and can be used to get statistics
+    /// about the achieved frame times.
+    /// \code
+    /// sf::Time mean = window.getFramePacer().getAverageFrameTime();
+    /// sf::Time p99 = window.getFramePacer().getFrameTimePercentile(99);
+    /// \endcode
+    ///
+    /// \return Frame pacer of the window
+    ///
+    /// \see setFramerateLimit
+    ///
+    ////////////////////////////////////////////////////////////
+    const FramePacer& getFramePacer() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Change the joystick threshold
     ///
@@ -563,8 +584,7 @@ private:
     ////////////////////////////////////////////////////////////
     priv::WindowImpl* m_impl;           ///< Platform-specific implementation of the window
     priv::GlContext*  m_context;        ///< Platform-specific implementation of the OpenGL context
-    Clock             m_clock;          ///< Clock for measuring the elapsed time between frames
-    Time              m_frameTimeLimit; ///< Current framerate limit
+    FramePacer        m_framePacer;     ///< Paces the frames according to the framerate limit
     Vector2u          m_size;           ///< Current size of the window
 };
 
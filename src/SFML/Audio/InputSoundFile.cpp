@@ -30,6 +30,7 @@
 #include <SFML/Audio/SoundFileFactory.hpp>
 #include <SFML/System/InputStream.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 #include <SFML/System/Err.hpp>
 
@@ -68,8 +69,12 @@ bool InputSoundFile::openFromFile(const std::string& filename)
     if (!m_reader)
         return false;
 
-    // Wrap the file into a stream
+    // Wrap the file into a stream (memory-mapped, except for Android assets which can't be mapped)
+#ifndef SFML_SYSTEM_ANDROID
+    MappedFileInputStream* file = new MappedFileInputStream;
+#else
     FileInputStream* file = new FileInputStream;
+#endif
     m_stream = file;
     m_streamOwned = true;
 
@@ -39,6 +39,7 @@
 #include <SFML/Audio/SoundFileReaderWav.hpp>
 #include <SFML/Audio/SoundFileWriterWav.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/MemoryInputStream.hpp>
 #include <SFML/System/Err.hpp>
 
@@ -81,7 +82,11 @@ SoundFileReader* SoundFileFactory::createReaderFromFilename(const std::string& f
     ensureDefaultReadersWritersRegistered();
 
     // Wrap the input file into a file stream
+#ifndef SFML_SYSTEM_ANDROID
+    MappedFileInputStream stream;
+#else
     FileInputStream stream;
+#endif
     if (!stream.open(filename)) {
         err() << "Failed to open sound file \"" << filename << "\" (couldn't open stream)" << std::endl;
         return NULL;
@@ -28,7 +28,7 @@
 #include <SFML/Audio/SoundRecorder.hpp>
 #include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/ALCheck.hpp>
-#include <SFML/System/Sleep.hpp>
+#include <SFML/System/Lock.hpp>
 #include <SFML/System/Err.hpp>
 #include <cstring>
 #include <cassert>
@@ -48,6 +48,9 @@ namespace sf
 ////////////////////////////////////////////////////////////
 SoundRecorder::SoundRecorder() :
 m_thread            (&SoundRecorder::record, this),
+m_threadMutex       (),
+m_threadCondition   (),
+m_processedFrames   (0),
 m_sampleRate        (0),
 m_processingInterval(milliseconds(100)),
 m_isCapturing       (false),
@@ -98,8 +101,11 @@ bool SoundRecorder::start(unsigned int sampleRate)
         return false;
     }
 
-    // Clear the array of samples
-    m_samples.clear();
+    // Allocate the array of samples once for the whole capture; it can hold
+    // the entire capture buffer of the device (one second of audio), so that
+    // it never has to be resized while recording
+    m_samples.resize(sampleRate * m_channelCount);
+    m_processedFrames = 0;
 
     // Store the sample rate
     m_sampleRate = sampleRate;
@@ -127,7 +133,7 @@ void SoundRecorder::stop()
     // Stop the capturing thread if there is one
     if (m_isCapturing)
     {
-        m_isCapturing = false;
+        requestStop();
         m_thread.wait();
 
         // Notify derived class
@@ -181,7 +187,7 @@ bool SoundRecorder::setDevice(const std::string& name)
     if (m_isCapturing)
     {
         // Stop the capturing thread
-        m_isCapturing = false;
+        requestStop();
         m_thread.wait();
 
         // Determine the recording format
@@ -258,6 +264,16 @@ void SoundRecorder::setProcessingInterval(Time interval)
 }
 
 
+////////////////////////////////////////////////////////////
+Time SoundRecorder::getCaptureOffset() const
+{
+    if (m_sampleRate == 0)
+        return Time::Zero;
+
+    return microseconds(static_cast<Int64>(m_processedFrames * 1000000 / m_sampleRate));
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundRecorder::onStart()
 {
@@ -281,8 +297,15 @@ void SoundRecorder::record()
         // Process available samples
         processCapturedSamples();
 
-        // Don't bother the CPU while waiting for more captured data
-        sleep(m_processingInterval);
+        // Don't bother the CPU while waiting for more captured data;
+        // stop() wakes the thread up instead of waiting for a full interval
+        Lock lock(m_threadMutex);
+        if (m_isCapturing)
+        {
+            Time delay = getTimeUntilNextChunk();
+            if (delay > Time::Zero)
+                m_threadCondition.wait(m_threadMutex, delay);
+        }
     }
 
     // Capture is finished: clean up everything
@@ -297,14 +320,25 @@ void SoundRecorder::processCapturedSamples()
     ALCint samplesAvailable;
     alcGetIntegerv(captureDevice, ALC_CAPTURE_SAMPLES, 1, &samplesAvailable);
 
-    if (samplesAvailable > 0)
+    if ((samplesAvailable > 0) && !m_samples.empty())
     {
+        // Never read more than the buffer can hold, the remaining
+        // samples will be read on the next iteration
+        ALCint maxSamples = static_cast<ALCint>(m_samples.size() / getChannelCount());
+        if (samplesAvailable > maxSamples)
+            samplesAvailable = maxSamples;
+
         // Get the recorded samples
-        m_samples.resize(samplesAvailable * getChannelCount());
         alcCaptureSamples(captureDevice, &m_samples[0], samplesAvailable);
 
         // Forward them to the derived class
-        if (!onProcessSamples(&m_samples[0], m_samples.size()))
+        bool keepCapturing = onProcessSamples(&m_samples[0], samplesAvailable * getChannelCount());
+
+        // Only advance the capture offset now, so that the
+        // derived class gets the offset of the chunk's start
+        m_processedFrames += samplesAvailable;
+
+        if (!keepCapturing)
         {
             // The user wants to stop the capture
             m_isCapturing = false;
@@ -313,6 +347,33 @@ void SoundRecorder::processCapturedSamples()
 }
 
 
+////////////////////////////////////////////////////////////
+Time SoundRecorder::getTimeUntilNextChunk() const
+{
+    // Get the number of samples already waiting in the capture buffer
+    ALCint samplesAvailable;
+    alcGetIntegerv(captureDevice, ALC_CAPTURE_SAMPLES, 1, &samplesAvailable);
+
+    // Wait only for the part of the interval which hasn't been captured yet
+    Int64 intervalSamples = m_processingInterval.asMicroseconds() * m_sampleRate / 1000000;
+    Int64 missingSamples  = intervalSamples - samplesAvailable;
+    if (missingSamples <= 0)
+        return Time::Zero;
+
+    return microseconds(missingSamples * 1000000 / m_sampleRate);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundRecorder::requestStop()
+{
+    Lock lock(m_threadMutex);
+
+    m_isCapturing = false;
+    m_threadCondition.notifyAll();
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundRecorder::cleanup()
 {
@@ -28,7 +28,6 @@
 #include <SFML/Audio/SoundStream.hpp>
 #include <SFML/Audio/AudioDevice.hpp>
 #include <SFML/Audio/ALCheck.hpp>
-#include <SFML/System/Sleep.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Lock.hpp>
 
@@ -43,6 +42,7 @@ namespace sf
 SoundStream::SoundStream() :
 m_thread          (&SoundStream::streamData, this),
 m_threadMutex     (),
+m_threadCondition (),
 m_threadStartState(Stopped),
 m_isStreaming     (false),
 m_buffers         (),
@@ -66,6 +66,7 @@ SoundStream::~SoundStream()
     {
         Lock lock(m_threadMutex);
         m_isStreaming = false;
+        m_threadCondition.notifyAll();
     }
 
     // Wait for the thread to terminate
@@ -120,6 +121,7 @@ void SoundStream::play()
         // If the sound is paused, resume it
         Lock lock(m_threadMutex);
         m_threadStartState = Playing;
+        m_threadCondition.notifyAll();
         alCheck(alSourcePlay(m_source));
         return;
     }
@@ -160,6 +162,7 @@ void SoundStream::stop()
     {
         Lock lock(m_threadMutex);
         m_isStreaming = false;
+        m_threadCondition.notifyAll();
     }
 
     // Wait for the thread to terminate
@@ -382,9 +385,20 @@ void SoundStream::streamData()
             }
         }
 
-        // Leave some time for the other threads if the stream is still playing
+        // Leave some time for the other threads if the stream is still playing;
+        // a paused stream has nothing to do until play() or stop() is called
         if (SoundSource::getStatus() != Stopped)
-            sleep(milliseconds(10));
+        {
+            Lock lock(m_threadMutex);
+
+            if (m_isStreaming)
+            {
+                if (m_threadStartState == Paused)
+                    m_threadCondition.wait(m_threadMutex);
+                else
+                    m_threadCondition.wait(m_threadMutex, milliseconds(10));
+            }
+        }
     }
 
     // Stop the playback
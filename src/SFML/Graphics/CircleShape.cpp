@@ -26,7 +26,68 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
 #include <cmath>
+#include <map>
+#include <vector>
+
+
+namespace
+{
+    const float pi = 3.141592654f;
+
+    // Circles with more points than this don't use a shared table, so that
+    // animating the point count can't make the cache grow without bounds
+    const std::size_t maxCachedPointCount = 256;
+
+    struct UnitCircleCache
+    {
+        sf::Mutex mutex;
+        std::map<std::size_t, std::vector<sf::Vector2f> > tables;
+    };
+
+    // The cache is constructed on first use, so that it's available to
+    // the constructors of global circles defined in other units
+    UnitCircleCache& getUnitCircleCache()
+    {
+        static UnitCircleCache cache;
+        return cache;
+    }
+
+    // Make sure the cache is constructed during static initialization,
+    // before any thread can race on the initialization of the static above
+    UnitCircleCache& unitCircleCache = getUnitCircleCache();
+
+    // Compute a point of the unit circle
+    sf::Vector2f getUnitCirclePoint(std::size_t index, std::size_t pointCount)
+    {
+        float angle = index * 2 * pi / pointCount - pi / 2;
+        return sf::Vector2f(std::cos(angle), std::sin(angle));
+    }
+
+    // Get the points of the unit circle for a given point count, or NULL if
+    // they are not cached; tables are computed on first use and never
+    // released, so the returned pointer stays valid
+    const sf::Vector2f* getUnitCircle(std::size_t pointCount)
+    {
+        if ((pointCount == 0) || (pointCount > maxCachedPointCount))
+            return NULL;
+
+        UnitCircleCache& cache = getUnitCircleCache();
+        sf::Lock lock(cache.mutex);
+
+        std::vector<sf::Vector2f>& points = cache.tables[pointCount];
+        if (points.empty())
+        {
+            points.resize(pointCount);
+            for (std::size_t i = 0; i < pointCount; ++i)
+                points[i] = getUnitCirclePoint(i, pointCount);
+        }
+
+        return &points[0];
+    }
+}
 
 
 namespace sf
@@ -34,7 +95,8 @@ namespace sf
 ////////////////////////////////////////////////////////////
 CircleShape::CircleShape(float radius, std::size_t pointCount) :
 m_radius    (radius),
-m_pointCount(pointCount)
+m_pointCount(pointCount),
+m_unitPoints(getUnitCircle(pointCount))
 {
     update();
 }
@@ -59,6 +121,7 @@ float CircleShape::getRadius() const
 void CircleShape::setPointCount(std::size_t count)
 {
     m_pointCount = count;
+    m_unitPoints = getUnitCircle(count);
     update();
 }
 
@@ -72,13 +135,33 @@ std::size_t CircleShape::getPointCount() const
 ////////////////////////////////////////////////////////////
 Vector2f CircleShape::getPoint(std::size_t index) const
 {
-    static const float pi = 3.141592654f;
+    // There's no unit circle for a circle without points
+    if (m_pointCount == 0)
+        return Vector2f(m_radius, m_radius);
 
-    float angle = index * 2 * pi / m_pointCount - pi / 2;
-    float x = std::cos(angle) * m_radius;
-    float y = std::sin(angle) * m_radius;
+    Vector2f unitPoint = m_unitPoints ? m_unitPoints[index] : getUnitCirclePoint(index, m_pointCount);
+    float x = unitPoint.x * m_radius;
+    float y = unitPoint.y * m_radius;
 
     return Vector2f(m_radius + x, m_radius + y);
 }
 
+
+////////////////////////////////////////////////////////////
+void CircleShape::getPoints(Vector2f* points, std::size_t count) const
+{
+    // Large circles compute their points on the fly
+    if (!m_unitPoints)
+    {
+        Shape::getPoints(points, count);
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        points[i].x = m_radius + m_unitPoints[i].x * m_radius;
+        points[i].y = m_radius + m_unitPoints[i].y * m_radius;
+    }
+}
+
 } // namespace sf
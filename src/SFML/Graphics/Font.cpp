@@ -31,6 +31,7 @@
     #include <SFML/System/Android/ResourceStream.hpp>
 #endif
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/Err.hpp>
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -86,6 +87,7 @@ Font::Font() :
 m_library  (NULL),
 m_face     (NULL),
 m_streamRec(NULL),
+m_file     (NULL),
 m_stroker  (NULL),
 m_refCount (NULL),
 m_info     ()
@@ -101,6 +103,7 @@ Font::Font(const Font& copy) :
 m_library    (copy.m_library),
 m_face       (copy.m_face),
 m_streamRec  (copy.m_streamRec),
+m_file       (copy.m_file),
 m_stroker    (copy.m_stroker),
 m_refCount   (copy.m_refCount),
 m_info       (copy.m_info),
@@ -153,9 +156,24 @@ bool Font::loadFromFile(const std::string& filename)
     }
     m_library = library;
 
-    // Load the new font face from the specified file
+    // Load the new font face from the specified file; map it into memory if possible,
+    // so that FreeType reads it in place instead of going through the C library
     FT_Face face;
-    if (FT_New_Face(static_cast<FT_Library>(m_library), filename.c_str(), 0, &face) != 0)
+    FT_Error error;
+    MappedFileInputStream* file = new MappedFileInputStream;
+    if (file->open(filename) && file->getData())
+    {
+        m_file = file;
+        const FT_Byte* data = static_cast<const FT_Byte*>(file->getData());
+        error = FT_New_Memory_Face(static_cast<FT_Library>(m_library), data, static_cast<FT_Long>(file->getSize()), 0, &face);
+    }
+    else
+    {
+        delete file;
+        error = FT_New_Face(static_cast<FT_Library>(m_library), filename.c_str(), 0, &face);
+    }
+
+    if (error != 0)
     {
         err() << "Failed to load font \"" << filename << "\" (failed to create the font face)" << std::endl;
         return false;
@@ -470,6 +488,7 @@ Font& Font::operator =(const Font& right)
     std::swap(m_library,     temp.m_library);
     std::swap(m_face,        temp.m_face);
     std::swap(m_streamRec,   temp.m_streamRec);
+    std::swap(m_file,        temp.m_file);
     std::swap(m_stroker,     temp.m_stroker);
     std::swap(m_refCount,    temp.m_refCount);
     std::swap(m_info,        temp.m_info);
@@ -511,6 +530,9 @@ void Font::cleanup()
             if (m_streamRec)
                 delete static_cast<FT_StreamRec*>(m_streamRec);
 
+            // Unmap the font file, if any (must be done after FT_Done_Face!)
+            delete m_file;
+
             // Close the library
             if (m_library)
                 FT_Done_FreeType(static_cast<FT_Library>(m_library));
@@ -522,6 +544,7 @@ void Font::cleanup()
     m_face      = NULL;
     m_stroker   = NULL;
     m_streamRec = NULL;
+    m_file      = NULL;
     m_refCount  = NULL;
     m_pages.clear();
     std::vector<Uint8>().swap(m_pixelBuffer);
@@ -136,6 +136,12 @@
     // Core since 3.0 - NV_copy_buffer
     #define GLEXT_copy_buffer                         false
 
+    // Core since 3.0 - NV_pixel_buffer_object
+    #define GLEXT_pixel_buffer_object                 false
+
+    // Core since 3.0
+    #define GLEXT_sync                                false
+
     // Core since 3.0 - EXT_sRGB
     #ifdef GL_EXT_sRGB
         #define GLEXT_texture_sRGB                        GL_EXT_sRGB
@@ -312,6 +318,22 @@
     #define GLEXT_geometry_shader4                    sfogl_ext_ARB_geometry_shader4
     #define GLEXT_GL_GEOMETRY_SHADER                  GL_GEOMETRY_SHADER_ARB
 
+    // Core since 2.1 - ARB_pixel_buffer_object
+    #define GLEXT_pixel_buffer_object                 sfogl_ext_ARB_pixel_buffer_object
+    #define GLEXT_GL_PIXEL_PACK_BUFFER                GL_PIXEL_PACK_BUFFER_ARB
+    #define GLEXT_GL_PIXEL_PACK_BUFFER_BINDING        GL_PIXEL_PACK_BUFFER_BINDING_ARB
+    #define GLEXT_GL_STREAM_READ                      GL_STREAM_READ_ARB
+
+    // Core since 3.2 - ARB_sync
+    #define GLEXT_sync                                sfogl_ext_ARB_sync
+    #define GLEXT_GL_ALREADY_SIGNALED                 GL_ALREADY_SIGNALED
+    #define GLEXT_GL_CONDITION_SATISFIED              GL_CONDITION_SATISFIED
+    #define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT          GL_SYNC_FLUSH_COMMANDS_BIT
+    #define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE       GL_SYNC_GPU_COMMANDS_COMPLETE
+    #define GLEXT_glClientWaitSync                    glClientWaitSync
+    #define GLEXT_glDeleteSync                        glDeleteSync
+    #define GLEXT_glFenceSync                         glFenceSync
+
 #endif
 
 namespace sf
@@ -53,6 +53,8 @@ int sfogl_ext_EXT_framebuffer_blit = sfogl_LOAD_FAILED;
 int sfogl_ext_EXT_framebuffer_multisample = sfogl_LOAD_FAILED;
 int sfogl_ext_ARB_copy_buffer = sfogl_LOAD_FAILED;
 int sfogl_ext_ARB_geometry_shader4 = sfogl_LOAD_FAILED;
+int sfogl_ext_ARB_pixel_buffer_object = sfogl_LOAD_FAILED;
+int sfogl_ext_ARB_sync = sfogl_LOAD_FAILED;
 
 void (GL_FUNCPTR *sf_ptrc_glBlendEquationEXT)(GLenum) = NULL;
 
@@ -935,6 +937,29 @@ static int Load_ARB_geometry_shader4()
     return numFailed;
 }
 
+GLenum (GL_FUNCPTR *sf_ptrc_glClientWaitSync)(GLsync, GLbitfield, GLuint64) = NULL;
+void (GL_FUNCPTR *sf_ptrc_glDeleteSync)(GLsync) = NULL;
+GLsync (GL_FUNCPTR *sf_ptrc_glFenceSync)(GLenum, GLbitfield) = NULL;
+
+static int Load_ARB_sync()
+{
+    int numFailed = 0;
+
+    sf_ptrc_glClientWaitSync = reinterpret_cast<GLenum (GL_FUNCPTR *)(GLsync, GLbitfield, GLuint64)>(glLoaderGetProcAddress("glClientWaitSync"));
+    if (!sf_ptrc_glClientWaitSync)
+        numFailed++;
+
+    sf_ptrc_glDeleteSync = reinterpret_cast<void (GL_FUNCPTR *)(GLsync)>(glLoaderGetProcAddress("glDeleteSync"));
+    if (!sf_ptrc_glDeleteSync)
+        numFailed++;
+
+    sf_ptrc_glFenceSync = reinterpret_cast<GLsync (GL_FUNCPTR *)(GLenum, GLbitfield)>(glLoaderGetProcAddress("glFenceSync"));
+    if (!sf_ptrc_glFenceSync)
+        numFailed++;
+
+    return numFailed;
+}
+
 typedef int (*PFN_LOADFUNCPOINTERS)();
 typedef struct sfogl_StrToExtMap_s
 {
@@ -943,7 +968,7 @@ typedef struct sfogl_StrToExtMap_s
     PFN_LOADFUNCPOINTERS LoadExtension;
 } sfogl_StrToExtMap;
 
-static sfogl_StrToExtMap ExtensionMap[20] = {
+static sfogl_StrToExtMap ExtensionMap[22] = {
     {"GL_SGIS_texture_edge_clamp", &sfogl_ext_SGIS_texture_edge_clamp, NULL},
     {"GL_EXT_texture_edge_clamp", &sfogl_ext_EXT_texture_edge_clamp, NULL},
     {"GL_EXT_blend_minmax", &sfogl_ext_EXT_blend_minmax, Load_EXT_blend_minmax},
@@ -963,10 +988,12 @@ static sfogl_StrToExtMap ExtensionMap[20] = {
     {"GL_EXT_framebuffer_blit", &sfogl_ext_EXT_framebuffer_blit, Load_EXT_framebuffer_blit},
     {"GL_EXT_framebuffer_multisample", &sfogl_ext_EXT_framebuffer_multisample, Load_EXT_framebuffer_multisample},
     {"GL_ARB_copy_buffer", &sfogl_ext_ARB_copy_buffer, Load_ARB_copy_buffer},
-    {"GL_ARB_geometry_shader4", &sfogl_ext_ARB_geometry_shader4, Load_ARB_geometry_shader4}
+    {"GL_ARB_geometry_shader4", &sfogl_ext_ARB_geometry_shader4, Load_ARB_geometry_shader4},
+    {"GL_ARB_pixel_buffer_object", &sfogl_ext_ARB_pixel_buffer_object, NULL},
+    {"GL_ARB_sync", &sfogl_ext_ARB_sync, Load_ARB_sync}
 };
 
-static int g_extensionMapSize = 20;
+static int g_extensionMapSize = 22;
 
 
 static void ClearExtensionVars()
@@ -991,6 +1018,8 @@ static void ClearExtensionVars()
     sfogl_ext_EXT_framebuffer_multisample = sfogl_LOAD_FAILED;
     sfogl_ext_ARB_copy_buffer = sfogl_LOAD_FAILED;
     sfogl_ext_ARB_geometry_shader4 = sfogl_LOAD_FAILED;
+    sfogl_ext_ARB_pixel_buffer_object = sfogl_LOAD_FAILED;
+    sfogl_ext_ARB_sync = sfogl_LOAD_FAILED;
 }
 
 
@@ -190,6 +190,8 @@ extern int sfogl_ext_EXT_framebuffer_blit;
 extern int sfogl_ext_EXT_framebuffer_multisample;
 extern int sfogl_ext_ARB_copy_buffer;
 extern int sfogl_ext_ARB_geometry_shader4;
+extern int sfogl_ext_ARB_pixel_buffer_object;
+extern int sfogl_ext_ARB_sync;
 
 #define GL_CLAMP_TO_EDGE_SGIS 0x812F
 
@@ -454,6 +456,18 @@ extern int sfogl_ext_ARB_geometry_shader4;
 #define GL_TRIANGLES_ADJACENCY_ARB 0x000C
 #define GL_TRIANGLE_STRIP_ADJACENCY_ARB 0x000D
 
+#define GL_PIXEL_PACK_BUFFER_ARB 0x88EB
+#define GL_PIXEL_PACK_BUFFER_BINDING_ARB 0x88ED
+#define GL_PIXEL_UNPACK_BUFFER_ARB 0x88EC
+#define GL_PIXEL_UNPACK_BUFFER_BINDING_ARB 0x88EF
+
+#define GL_ALREADY_SIGNALED 0x911A
+#define GL_CONDITION_SATISFIED 0x911C
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_TIMEOUT_EXPIRED 0x911B
+#define GL_WAIT_FAILED 0x911D
+
 #define GL_2D 0x0600
 #define GL_2_BYTES 0x1407
 #define GL_3D 0x0601
@@ -1353,6 +1367,16 @@ extern void (GL_FUNCPTR *sf_ptrc_glProgramParameteriARB)(GLuint, GLenum, GLint);
 #define glProgramParameteriARB sf_ptrc_glProgramParameteriARB
 #endif // GL_ARB_geometry_shader4
 
+#ifndef GL_ARB_sync
+#define GL_ARB_sync 1
+extern GLenum (GL_FUNCPTR *sf_ptrc_glClientWaitSync)(GLsync, GLbitfield, GLuint64);
+#define glClientWaitSync sf_ptrc_glClientWaitSync
+extern void (GL_FUNCPTR *sf_ptrc_glDeleteSync)(GLsync);
+#define glDeleteSync sf_ptrc_glDeleteSync
+extern GLsync (GL_FUNCPTR *sf_ptrc_glFenceSync)(GLenum, GLbitfield);
+#define glFenceSync sf_ptrc_glFenceSync
+#endif // GL_ARB_sync
+
 GLAPI void APIENTRY glAccum(GLenum, GLfloat);
 GLAPI void APIENTRY glAlphaFunc(GLenum, GLfloat);
 GLAPI void APIENTRY glBegin(GLenum);
@@ -148,9 +148,16 @@ bool Image::loadFromStream(InputStream& stream)
 
 
 ////////////////////////////////////////////////////////////
-bool Image::saveToFile(const std::string& filename) const
+bool Image::saveToFile(const std::string& filename, int compressionLevel) const
 {
-    return priv::ImageLoader::getInstance().saveImageToFile(filename, m_pixels, m_size);
+    return priv::ImageLoader::getInstance().saveImageToFile(filename, m_pixels, m_size, compressionLevel);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Image::saveToMemory(std::vector<Uint8>& output, const std::string& format, int compressionLevel) const
+{
+    return priv::ImageLoader::getInstance().saveImageToMemory(format, output, m_pixels, m_size, compressionLevel);
 }
 
 
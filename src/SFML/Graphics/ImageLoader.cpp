@@ -27,14 +27,20 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/ImageLoader.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
 #include <SFML/System/Err.hpp>
+#include <SFML/System/Thread.hpp>
 #ifdef SFML_INCLUDE_STB_IMAGE
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include <stb_image_write.h>
 #endif	// SFML_INCLUDE_STB_IMAGE
+#include <algorithm>
 #include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 
 namespace
@@ -63,6 +69,277 @@ namespace
         sf::InputStream* stream = static_cast<sf::InputStream*>(user);
         return stream->tell() >= stream->getSize();
     }
+
+#ifdef SFML_INCLUDE_STB_IMAGE
+
+    // stb_image_write callback that appends the encoded data to a std::vector
+    void bufferFromCallback(void* context, void* data, int size)
+    {
+        const sf::Uint8* source = static_cast<sf::Uint8*>(data);
+        std::vector<sf::Uint8>* dest = static_cast<std::vector<sf::Uint8>*>(context);
+        dest->insert(dest->end(), source, source + size);
+    }
+
+    // Table used to compute the CRC of the PNG chunks
+    struct CrcTable
+    {
+        CrcTable()
+        {
+            for (sf::Uint32 i = 0; i < 256; ++i)
+            {
+                sf::Uint32 crc = i;
+                for (int j = 0; j < 8; ++j)
+                    crc = (crc & 1) ? (0xEDB88320 ^ (crc >> 1)) : (crc >> 1);
+                values[i] = crc;
+            }
+        }
+
+        sf::Uint32 values[256];
+    };
+
+    const CrcTable crcTable;
+
+    // Append a big-endian 32 bits value to a buffer
+    void writeUint32(std::vector<sf::Uint8>& output, sf::Uint32 value)
+    {
+        output.push_back(static_cast<sf::Uint8>(value >> 24));
+        output.push_back(static_cast<sf::Uint8>(value >> 16));
+        output.push_back(static_cast<sf::Uint8>(value >> 8));
+        output.push_back(static_cast<sf::Uint8>(value));
+    }
+
+    // Append a PNG chunk (length, type, data and CRC) to a buffer
+    void writeChunk(std::vector<sf::Uint8>& output, const char* type, const sf::Uint8* data, std::size_t size)
+    {
+        writeUint32(output, static_cast<sf::Uint32>(size));
+
+        const std::size_t start = output.size();
+        output.insert(output.end(), type, type + 4);
+        if (size > 0)
+            output.insert(output.end(), data, data + size);
+
+        // The CRC covers the chunk type and data
+        sf::Uint32 crc = 0xFFFFFFFF;
+        for (std::size_t i = start; i < output.size(); ++i)
+            crc = crcTable.values[(crc ^ output[i]) & 0xFF] ^ (crc >> 8);
+
+        writeUint32(output, crc ^ 0xFFFFFFFF);
+    }
+
+    // Predictor used by the PNG "Paeth" filter
+    int paeth(int a, int b, int c)
+    {
+        int p  = a + b - c;
+        int pa = std::abs(p - a);
+        int pb = std::abs(p - b);
+        int pc = std::abs(p - c);
+
+        if ((pa <= pb) && (pa <= pc))
+            return a;
+        else if (pb <= pc)
+            return b;
+        else
+            return c;
+    }
+
+    // Filters a range of rows of a RGBA image, choosing for each row the filter
+    // type which minimizes the sum of absolute differences (the usual heuristic).
+    // Rows are independent, so ranges can be processed concurrently.
+    struct RowFilter
+    {
+        RowFilter(const sf::Uint8* pixels, unsigned int width, unsigned int first, unsigned int last, bool adaptive, sf::Uint8* output) :
+        pixels  (pixels),
+        width   (width),
+        first   (first),
+        last    (last),
+        adaptive(adaptive),
+        output  (output)
+        {
+        }
+
+        void operator ()() const
+        {
+            const std::size_t pitch = static_cast<std::size_t>(width) * 4;
+
+            // Copies of the current and previous rows, with 4 bytes of padding in front
+            // of them so that the left neighbours of the first pixel read as zero
+            std::vector<sf::Uint8> line(pitch + 4, 0);
+            std::vector<sf::Uint8> above(pitch + 4, 0);
+
+            for (unsigned int y = first; y < last; ++y)
+            {
+                const sf::Uint8* row = pixels + y * pitch;
+                sf::Uint8* dest = output + y * (pitch + 1);
+
+                if (!adaptive)
+                {
+                    // Filter type 0 (none), just copy the pixels
+                    dest[0] = 0;
+                    std::memcpy(dest + 1, row, pitch);
+                    continue;
+                }
+
+                // The row above the first one is considered to be made of zeros
+                std::memcpy(&line[4], row, pitch);
+                if (y > 0)
+                    std::memcpy(&above[4], row - pitch, pitch);
+
+                const sf::Uint8* x = &line[4];
+                const sf::Uint8* b = &above[4];
+
+                // Estimate the cost of each filter type in a single pass
+                unsigned long costs[5] = {0, 0, 0, 0, 0};
+                for (std::size_t i = 0; i < pitch; ++i)
+                {
+                    int left = x[i - 4];
+                    int up = b[i];
+                    int upLeft = b[i - 4];
+                    costs[0] += std::abs(static_cast<signed char>(x[i]));
+                    costs[1] += std::abs(static_cast<signed char>(x[i] - left));
+                    costs[2] += std::abs(static_cast<signed char>(x[i] - up));
+                    costs[3] += std::abs(static_cast<signed char>(x[i] - ((left + up) >> 1)));
+                    costs[4] += std::abs(static_cast<signed char>(x[i] - paeth(left, up, upLeft)));
+                }
+
+                int type = 0;
+                for (int i = 1; i < 5; ++i)
+                {
+                    if (costs[i] < costs[type])
+                        type = i;
+                }
+
+                // Write the filtered row, preceded by its filter type
+                dest[0] = static_cast<sf::Uint8>(type);
+                for (std::size_t i = 0; i < pitch; ++i)
+                {
+                    int left = x[i - 4];
+                    int up = b[i];
+                    int upLeft = b[i - 4];
+
+                    switch (type)
+                    {
+                        case 0: dest[i + 1] = x[i];                                                 break;
+                        case 1: dest[i + 1] = static_cast<sf::Uint8>(x[i] - left);                  break;
+                        case 2: dest[i + 1] = static_cast<sf::Uint8>(x[i] - up);                    break;
+                        case 3: dest[i + 1] = static_cast<sf::Uint8>(x[i] - ((left + up) >> 1));    break;
+                        case 4: dest[i + 1] = static_cast<sf::Uint8>(x[i] - paeth(left, up, upLeft)); break;
+                    }
+                }
+            }
+        }
+
+        const sf::Uint8* pixels;
+        unsigned int     width;
+        unsigned int     first;
+        unsigned int     last;
+        bool             adaptive;
+        sf::Uint8*       output;
+    };
+
+    // Encode a RGBA image to the PNG format
+    bool encodePng(std::vector<sf::Uint8>& output, const std::vector<sf::Uint8>& pixels, const sf::Vector2u& size, int compressionLevel)
+    {
+        const std::size_t pitch = static_cast<std::size_t>(size.x) * 4 + 1;
+        std::vector<sf::Uint8> filtered(pitch * size.y);
+
+        // Without compression, filtering the rows would only waste time
+        const bool adaptive = compressionLevel > 0;
+
+        // Filtering is done in parallel for large images, each thread handling a band of rows
+        const unsigned int threadCount = (static_cast<std::size_t>(size.x) * size.y >= 512 * 512) && (size.y >= 64) ? 4 : 1;
+        const unsigned int band = size.y / threadCount;
+
+        std::vector<sf::Thread*> threads;
+        for (unsigned int i = 1; i < threadCount; ++i)
+        {
+            unsigned int last = (i + 1 < threadCount) ? (i + 1) * band : size.y;
+            threads.push_back(new sf::Thread(RowFilter(&pixels[0], size.x, i * band, last, adaptive, &filtered[0])));
+            threads.back()->launch();
+        }
+
+        RowFilter(&pixels[0], size.x, 0, band, adaptive, &filtered[0])();
+
+        for (std::vector<sf::Thread*>::iterator it = threads.begin(); it != threads.end(); ++it)
+        {
+            (*it)->wait();
+            delete *it;
+        }
+
+        // Compress the filtered rows
+        std::vector<sf::Uint8> compressed;
+        if (compressionLevel <= 0)
+        {
+            // No compression: zlib header followed by stored blocks
+            compressed.reserve(filtered.size() + filtered.size() / 65535 * 5 + 11);
+            compressed.push_back(0x78);
+            compressed.push_back(0x01);
+
+            std::size_t offset = 0;
+            do
+            {
+                std::size_t length = std::min<std::size_t>(filtered.size() - offset, 65535);
+                bool last = offset + length == filtered.size();
+                compressed.push_back(last ? 1 : 0);
+                compressed.push_back(static_cast<sf::Uint8>(length & 0xFF));
+                compressed.push_back(static_cast<sf::Uint8>(length >> 8));
+                compressed.push_back(static_cast<sf::Uint8>(~length & 0xFF));
+                compressed.push_back(static_cast<sf::Uint8>((~length >> 8) & 0xFF));
+                compressed.insert(compressed.end(), filtered.begin() + offset, filtered.begin() + offset + length);
+                offset += length;
+            }
+            while (offset < filtered.size());
+
+            // Adler-32 checksum of the uncompressed data
+            sf::Uint32 s1 = 1;
+            sf::Uint32 s2 = 0;
+            for (std::size_t i = 0; i < filtered.size();)
+            {
+                // 5552 is the largest number of bytes that can be summed before s2 overflows
+                std::size_t end = std::min<std::size_t>(i + 5552, filtered.size());
+                for (; i < end; ++i)
+                {
+                    s1 += filtered[i];
+                    s2 += s1;
+                }
+                s1 %= 65521;
+                s2 %= 65521;
+            }
+            writeUint32(compressed, (s2 << 16) | s1);
+        }
+        else
+        {
+            // stb_image_write's deflate searches longer hash chains as its quality increases,
+            // level 6 maps to the quality it uses by default
+            int length = 0;
+            unsigned char* data = stbi_zlib_compress(&filtered[0], static_cast<int>(filtered.size()), &length, std::min(compressionLevel, 9) + 2);
+            if (!data)
+                return false;
+
+            compressed.assign(data, data + length);
+            STBIW_FREE(data);
+        }
+
+        // Write the PNG signature and chunks
+        static const sf::Uint8 signature[] = {137, 80, 78, 71, 13, 10, 26, 10};
+        output.insert(output.end(), signature, signature + 8);
+
+        std::vector<sf::Uint8> header;
+        writeUint32(header, size.x);
+        writeUint32(header, size.y);
+        header.push_back(8); // bit depth
+        header.push_back(6); // color type: RGBA
+        header.push_back(0); // compression method
+        header.push_back(0); // filter method
+        header.push_back(0); // interlace method
+
+        writeChunk(output, "IHDR", &header[0], header.size());
+        writeChunk(output, "IDAT", &compressed[0], compressed.size());
+        writeChunk(output, "IEND", NULL, 0);
+
+        return true;
+    }
+
+#endif	// SFML_INCLUDE_STB_IMAGE
 }
 
 
@@ -100,11 +377,20 @@ bool ImageLoader::loadImageFromFile(const std::string& filename, std::vector<Uin
     pixels.clear();
 
 #ifdef SFML_INCLUDE_STB_IMAGE
+    // Map the file into memory, so that it can be decoded in place
+    MappedFileInputStream file;
+    if (!file.open(filename) || !file.getData())
+    {
+        err() << "Failed to load image \"" << filename << "\". Reason: Unable to open file" << std::endl;
+        return false;
+    }
+
     // Load the image and get a pointer to the pixels in memory
     int width = 0;
     int height = 0;
     int channels = 0;
-    unsigned char* ptr = stbi_load(filename.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+    const stbi_uc* buffer = static_cast<const stbi_uc*>(file.getData());
+    unsigned char* ptr = stbi_load_from_memory(buffer, static_cast<int>(file.getSize()), &width, &height, &channels, STBI_rgb_alpha);
 
     if (ptr)
     {
@@ -245,46 +531,71 @@ bool ImageLoader::loadImageFromStream(InputStream& stream, std::vector<Uint8>& p
 
 
 ////////////////////////////////////////////////////////////
-bool ImageLoader::saveImageToFile(const std::string& filename, const std::vector<Uint8>& pixels, const Vector2u& size)
+bool ImageLoader::saveImageToFile(const std::string& filename, const std::vector<Uint8>& pixels, const Vector2u& size, int compressionLevel)
 {
+    // Deduce the image type from its extension
+    const std::size_t dot = filename.find_last_of('.');
+    const std::string extension = dot != std::string::npos ? filename.substr(dot + 1) : "";
+
+    // Encode the image in memory, then write it in a single call
+    std::vector<Uint8> buffer;
+    if (saveImageToMemory(extension, buffer, pixels, size, compressionLevel))
+    {
+        std::FILE* file = std::fopen(filename.c_str(), "wb");
+        if (file)
+        {
+            bool written = std::fwrite(&buffer[0], 1, buffer.size(), file) == buffer.size();
+            written = (std::fclose(file) == 0) && written;
+
+            if (written)
+                return true;
+        }
+    }
+
+    err() << "Failed to save image \"" << filename << "\"" << std::endl;
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageLoader::saveImageToMemory(const std::string& format, std::vector<Uint8>& output, const std::vector<Uint8>& pixels, const Vector2u& size, int compressionLevel)
+{
+    // Clear the array (just in case)
+    output.clear();
+
 #ifdef SFML_INCLUDE_STB_IMAGE
     // Make sure the image is not empty
     if (!pixels.empty() && (size.x > 0) && (size.y > 0))
     {
-        // Deduce the image type from its extension
+        const std::string specified = toLower(format);
 
-        // Extract the extension
-        const std::size_t dot = filename.find_last_of('.');
-        const std::string extension = dot != std::string::npos ? toLower(filename.substr(dot + 1)) : "";
-
-        if (extension == "bmp")
+        if (specified == "bmp")
         {
             // BMP format
-            if (stbi_write_bmp(filename.c_str(), size.x, size.y, 4, &pixels[0]))
+            if (stbi_write_bmp_to_func(&bufferFromCallback, &output, size.x, size.y, 4, &pixels[0]))
                 return true;
         }
-        else if (extension == "tga")
+        else if (specified == "tga")
         {
             // TGA format
-            if (stbi_write_tga(filename.c_str(), size.x, size.y, 4, &pixels[0]))
+            if (stbi_write_tga_to_func(&bufferFromCallback, &output, size.x, size.y, 4, &pixels[0]))
                 return true;
         }
-        else if (extension == "png")
+        else if (specified == "png")
         {
             // PNG format
-            if (stbi_write_png(filename.c_str(), size.x, size.y, 4, &pixels[0], 0))
+            if (encodePng(output, pixels, size, compressionLevel))
                 return true;
         }
-        else if (extension == "jpg" || extension == "jpeg")
+        else if (specified == "jpg" || specified == "jpeg")
         {
             // JPG format
-            if (stbi_write_jpg(filename.c_str(), size.x, size.y, 4, &pixels[0], 90))
+            if (stbi_write_jpg_to_func(&bufferFromCallback, &output, size.x, size.y, 4, &pixels[0], 90))
                 return true;
         }
     }
 #endif	// SFML_INCLUDE_STB_IMAGE
 
-    err() << "Failed to save image \"" << filename << "\"" << std::endl;
     return false;
 }
 
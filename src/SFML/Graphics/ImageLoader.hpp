@@ -96,14 +96,29 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Save an array of pixels as an image file
     ///
-    /// \param filename Path of image file to save
-    /// \param pixels   Array of pixels to save to image
-    /// \param size     Size of image to save, in pixels
+    /// \param filename         Path of image file to save
+    /// \param pixels           Array of pixels to save to image
+    /// \param size             Size of image to save, in pixels
+    /// \param compressionLevel Compression level used for PNG files (0-9)
     ///
     /// \return True if saving was successful
     ///
     ////////////////////////////////////////////////////////////
-    bool saveImageToFile(const std::string& filename, const std::vector<Uint8>& pixels, const Vector2u& size);
+    bool saveImageToFile(const std::string& filename, const std::vector<Uint8>& pixels, const Vector2u& size, int compressionLevel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save an array of pixels as an encoded image buffer
+    ///
+    /// \param format           Must be "bmp", "png", "tga" or "jpg"/"jpeg".
+    /// \param output           Buffer to fill with encoded data
+    /// \param pixels           Array of pixels to save to image
+    /// \param size             Size of image to save, in pixels
+    /// \param compressionLevel Compression level used for PNG files (0-9)
+    ///
+    /// \return True if saving was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    bool saveImageToMemory(const std::string& format, std::vector<Uint8>& output, const std::vector<Uint8>& pixels, const Vector2u& size, int compressionLevel);
 
 private:
 
@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ImageWriter.hpp>
+#include <SFML/System/Lock.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ImageWriter::ImageWriter() :
+m_thread      (&ImageWriter::run, this),
+m_working     (false),
+m_failureCount(0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ImageWriter::~ImageWriter()
+{
+    wait();
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageWriter::save(const Image& image, const std::string& filename, int compressionLevel)
+{
+    // Copy the image before locking, so that the worker is never blocked by the copy
+    Job* job = new Job;
+    job->image = image;
+    job->filename = filename;
+    job->compressionLevel = compressionLevel;
+
+    bool start = false;
+
+    {
+        Lock lock(m_mutex);
+
+        m_jobs.push_back(job);
+
+        if (!m_working)
+        {
+            m_working = true;
+            start = true;
+        }
+    }
+
+    if (start)
+    {
+        // The previous run of the worker (if any) has emptied the queue
+        // and is about to return, so this doesn't block
+        m_thread.wait();
+        m_thread.launch();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageWriter::wait()
+{
+    // The worker thread only exits when the queue is empty
+    m_thread.wait();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ImageWriter::getFailureCount() const
+{
+    Lock lock(m_mutex);
+
+    return m_failureCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageWriter::run()
+{
+    for (;;)
+    {
+        Job* job = NULL;
+
+        {
+            Lock lock(m_mutex);
+
+            if (m_jobs.empty())
+            {
+                m_working = false;
+                return;
+            }
+
+            job = m_jobs.front();
+            m_jobs.pop_front();
+        }
+
+        bool saved = job->image.saveToFile(job->filename, job->compressionLevel);
+        delete job;
+
+        if (!saved)
+        {
+            Lock lock(m_mutex);
+            ++m_failureCount;
+        }
+    }
+}
+
+} // namespace sf
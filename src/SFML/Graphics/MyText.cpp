@@ -72,6 +72,17 @@ void MyText::setString(const String& string)
 }
 
 
+////////////////////////////////////////////////////////////
+void MyText::swapString(String& string)
+{
+    if (m_string != string)
+    {
+        m_string.swap(string);
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void MyText::setFont(const MyFont& font)
 {
@@ -133,10 +133,13 @@ namespace sf
 {
 ////////////////////////////////////////////////////////////
 RenderTarget::RenderTarget() :
-m_defaultView(),
-m_view       (),
-m_cache      (),
-m_id         (0)
+m_defaultView   (),
+m_view          (),
+m_cache         (),
+m_id            (0),
+m_cullingEnabled(false),
+m_drawnCount    (0),
+m_culledCount   (0)
 {
     m_cache.glStatesSet = false;
 }
@@ -247,6 +250,23 @@ Vector2i RenderTarget::mapCoordsToPixel(const Vector2f& point, const View& view)
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const Drawable& drawable, const RenderStates& states)
 {
+    FloatRect bounds;
+    if (m_cullingEnabled && drawable.getCullingBounds(bounds))
+    {
+        // Compare the bounds in world coordinates to the area covered by the view;
+        // the comparisons are inclusive so that flat objects (lines) are not culled
+        bounds = states.transform.transformRect(bounds);
+        FloatRect area = m_view.getInverseTransform().transformRect(FloatRect(-1.f, -1.f, 2.f, 2.f));
+
+        if ((bounds.left > area.left + area.width) || (bounds.left + bounds.width < area.left) ||
+            (bounds.top > area.top + area.height) || (bounds.top + bounds.height < area.top))
+        {
+            m_culledCount++;
+            return;
+        }
+    }
+
+    m_drawnCount++;
     drawable.draw(*this, states);
 }
 
@@ -282,13 +302,8 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount,
         if (useVertexCache)
         {
             // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex = m_cache.vertexCache[i];
-                vertex.position = states.transform * vertices[i].position;
-                vertex.color = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
+            std::copy(vertices, vertices + vertexCount, m_cache.vertexCache);
+            states.transform.transformVertices(m_cache.vertexCache, vertexCount);
         }
 
         setupDraw(useVertexCache, states);
@@ -417,6 +432,42 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::setCullingEnabled(bool enabled)
+{
+    m_cullingEnabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isCullingEnabled() const
+{
+    return m_cullingEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTarget::getDrawnCount() const
+{
+    return m_drawnCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTarget::getCulledCount() const
+{
+    return m_culledCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetCullingCounters()
+{
+    m_drawnCount = 0;
+    m_culledCount = 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTarget::setActive(bool active)
 {
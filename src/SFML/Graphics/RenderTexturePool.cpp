@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTexturePool.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <algorithm>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderTexturePool::Key::Key(unsigned int width, unsigned int height, const ContextSettings& settings)
+{
+    values[0] = width;
+    values[1] = height;
+    values[2] = settings.depthBits;
+    values[3] = settings.stencilBits;
+    values[4] = settings.antialiasingLevel;
+    values[5] = settings.majorVersion;
+    values[6] = settings.minorVersion;
+    values[7] = settings.attributeFlags;
+    values[8] = settings.sRgbCapable ? 1 : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTexturePool::Key::operator <(const Key& right) const
+{
+    return std::lexicographical_compare(values, values + 9, right.values, right.values + 9);
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool() :
+m_idleTextures    (),
+m_acquiredTextures(),
+m_createdCount    (0),
+m_reusedCount     (0)
+{
+
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::~RenderTexturePool()
+{
+    clear();
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::acquire(unsigned int width, unsigned int height, const ContextSettings& settings)
+{
+    Key key(width, height, settings);
+
+    // Look for an idle render texture with the same size and settings
+    TextureTable::iterator it = m_idleTextures.find(key);
+    if ((it != m_idleTextures.end()) && !it->second.empty())
+    {
+        RenderTexture* renderTexture = it->second.back();
+        it->second.pop_back();
+
+        // Restore the state of a newly created render texture
+        renderTexture->setView(renderTexture->getDefaultView());
+        renderTexture->setSmooth(false);
+        renderTexture->setRepeated(false);
+
+        setAcquired(renderTexture, key);
+        ++m_reusedCount;
+
+        return renderTexture;
+    }
+
+    // None available: create a new one
+    RenderTexture* renderTexture = new RenderTexture;
+    if (!renderTexture->create(width, height, settings))
+    {
+        delete renderTexture;
+        return NULL;
+    }
+
+    setAcquired(renderTexture, key);
+    ++m_createdCount;
+
+    return renderTexture;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::release(RenderTexture* renderTexture)
+{
+    KeyTable::iterator it = m_acquiredTextures.find(renderTexture);
+    if (it == m_acquiredTextures.end())
+        return;
+
+    m_idleTextures[it->second].push_back(renderTexture);
+    m_acquiredTextures.erase(it);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::discard(RenderTexture* renderTexture)
+{
+    KeyTable::iterator it = m_acquiredTextures.find(renderTexture);
+    if (it == m_acquiredTextures.end())
+        return;
+
+    m_acquiredTextures.erase(it);
+    delete renderTexture;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getIdleCount() const
+{
+    std::size_t count = 0;
+    for (TextureTable::const_iterator it = m_idleTextures.begin(); it != m_idleTextures.end(); ++it)
+        count += it->second.size();
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getCreatedCount() const
+{
+    return m_createdCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getReusedCount() const
+{
+    return m_reusedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::clear()
+{
+    for (TextureTable::iterator it = m_idleTextures.begin(); it != m_idleTextures.end(); ++it)
+    {
+        for (std::vector<RenderTexture*>::iterator texture = it->second.begin(); texture != it->second.end(); ++texture)
+            delete *texture;
+    }
+
+    m_idleTextures.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::setAcquired(const RenderTexture* renderTexture, const Key& key)
+{
+    // Overwrite the key if the address was already recorded, so that the
+    // render texture always goes back to the right bucket when released
+    std::pair<KeyTable::iterator, bool> result = m_acquiredTextures.insert(std::make_pair(renderTexture, key));
+    if (!result.second)
+        result.first->second = key;
+}
+
+} // namespace sf
@@ -142,6 +142,14 @@ float Shape::getOutlineThickness() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Shape::getPoints(Vector2f* points, std::size_t count) const
+{
+    for (std::size_t i = 0; i < count; ++i)
+        points[i] = getPoint(i);
+}
+
+
 ////////////////////////////////////////////////////////////
 FloatRect Shape::getLocalBounds() const
 {
@@ -165,6 +173,7 @@ m_outlineColor    (255, 255, 255),
 m_outlineThickness(0),
 m_vertices        (TriangleFan),
 m_outlineVertices (TriangleStrip),
+m_points          (),
 m_insideBounds    (),
 m_bounds          ()
 {
@@ -185,9 +194,14 @@ void Shape::update()
 
     m_vertices.resize(count + 2); // + 2 for center and repeated first point
 
-    // Position
+    // Position; the points buffer only grows, so that updating
+    // a shape doesn't allocate memory once its size is known
+    if (m_points.size() < count)
+        m_points.resize(count);
+
+    getPoints(&m_points[0], count);
     for (std::size_t i = 0; i < count; ++i)
-        m_vertices[i + 1].position = getPoint(i);
+        m_vertices[i + 1].position = m_points[i];
     m_vertices[count + 1].position = m_vertices[1].position;
 
     // Update the bounding rectangle
@@ -227,6 +241,14 @@ void Shape::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+bool Shape::getCullingBounds(FloatRect& bounds) const
+{
+    bounds = getGlobalBounds();
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shape::updateFillColors()
 {
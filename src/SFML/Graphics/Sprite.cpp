@@ -145,6 +145,14 @@ void Sprite::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+bool Sprite::getCullingBounds(FloatRect& bounds) const
+{
+    bounds = getGlobalBounds();
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Sprite::updatePositions()
 {
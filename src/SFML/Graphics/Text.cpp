@@ -127,6 +127,17 @@ void Text::setString(const String& string)
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::swapString(String& string)
+{
+    if (m_string != string)
+    {
+        m_string.swap(string);
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::setFont(const Font& font)
 {
@@ -389,6 +400,14 @@ void Text::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+bool Text::getCullingBounds(FloatRect& bounds) const
+{
+    bounds = getGlobalBounds();
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
@@ -464,8 +464,6 @@ void Texture::update(const Texture& texture, unsigned int x, unsigned int y)
     if (!m_texture || !texture.m_texture)
         return;
 
-#ifndef SFML_OPENGL_ES
-
     {
         TransientContextLock lock;
 
@@ -473,6 +471,12 @@ void Texture::update(const Texture& texture, unsigned int x, unsigned int y)
         priv::ensureExtensionsInit();
     }
 
+    // Both GPU paths below copy the texture without any round-trip through
+    // system memory; the readback path at the end is only used as a last resort
+    bool copied = false;
+
+#ifndef SFML_OPENGL_ES
+
     if (GLEXT_framebuffer_object && GLEXT_framebuffer_blit)
     {
         TransientContextLock lock;
@@ -490,48 +494,104 @@ void Texture::update(const Texture& texture, unsigned int x, unsigned int y)
         glCheck(GLEXT_glGenFramebuffers(1, &sourceFrameBuffer));
         glCheck(GLEXT_glGenFramebuffers(1, &destFrameBuffer));
 
-        if (!sourceFrameBuffer || !destFrameBuffer)
+        if (sourceFrameBuffer && destFrameBuffer)
         {
-            err() << "Cannot copy texture, failed to create a frame buffer object" << std::endl;
-            return;
-        }
+            // Link the source texture to the source frame buffer
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_READ_FRAMEBUFFER, sourceFrameBuffer));
+            glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_READ_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.m_texture, 0));
 
-        // Link the source texture to the source frame buffer
-        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_READ_FRAMEBUFFER, sourceFrameBuffer));
-        glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_READ_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.m_texture, 0));
+            // Link the destination texture to the destination frame buffer
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, destFrameBuffer));
+            glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_DRAW_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_texture, 0));
 
-        // Link the destination texture to the destination frame buffer
-        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, destFrameBuffer));
-        glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_DRAW_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_texture, 0));
+            // A final check, just to be sure...
+            GLenum sourceStatus;
+            glCheck(sourceStatus = GLEXT_glCheckFramebufferStatus(GLEXT_GL_READ_FRAMEBUFFER));
 
-        // A final check, just to be sure...
-        GLenum sourceStatus;
-        glCheck(sourceStatus = GLEXT_glCheckFramebufferStatus(GLEXT_GL_READ_FRAMEBUFFER));
+            GLenum destStatus;
+            glCheck(destStatus = GLEXT_glCheckFramebufferStatus(GLEXT_GL_DRAW_FRAMEBUFFER));
 
-        GLenum destStatus;
-        glCheck(destStatus = GLEXT_glCheckFramebufferStatus(GLEXT_GL_DRAW_FRAMEBUFFER));
+            if ((sourceStatus == GLEXT_GL_FRAMEBUFFER_COMPLETE) && (destStatus == GLEXT_GL_FRAMEBUFFER_COMPLETE))
+            {
+                // Blit the texture contents from the source to the destination texture
+                glCheck(GLEXT_glBlitFramebuffer(
+                    0, texture.m_pixelsFlipped ? texture.m_size.y : 0, texture.m_size.x, texture.m_pixelsFlipped ? 0 : texture.m_size.y, // Source rectangle, flip y if source is flipped
+                    x, y, x + texture.m_size.x, y + texture.m_size.y, // Destination rectangle
+                    GL_COLOR_BUFFER_BIT, GL_NEAREST
+                ));
+
+                copied = true;
+            }
 
-        if ((sourceStatus == GLEXT_GL_FRAMEBUFFER_COMPLETE) && (destStatus == GLEXT_GL_FRAMEBUFFER_COMPLETE))
-        {
-            // Blit the texture contents from the source to the destination texture
-            glCheck(GLEXT_glBlitFramebuffer(
-                0, texture.m_pixelsFlipped ? texture.m_size.y : 0, texture.m_size.x, texture.m_pixelsFlipped ? 0 : texture.m_size.y, // Source rectangle, flip y if source is flipped
-                x, y, x + texture.m_size.x, y + texture.m_size.y, // Destination rectangle
-                GL_COLOR_BUFFER_BIT, GL_NEAREST
-            ));
+            // Restore previously bound framebuffers
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_READ_FRAMEBUFFER, readFramebuffer));
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, drawFramebuffer));
         }
-        else
+
+        // Delete the framebuffers
+        if (sourceFrameBuffer)
+            glCheck(GLEXT_glDeleteFramebuffers(1, &sourceFrameBuffer));
+        if (destFrameBuffer)
+            glCheck(GLEXT_glDeleteFramebuffers(1, &destFrameBuffer));
+    }
+
+#endif // SFML_OPENGL_ES
+
+    if (!copied && GLEXT_framebuffer_object)
+    {
+        TransientContextLock lock;
+
+        // No blit available: attach the source texture to a frame buffer
+        // and let glCopyTexSubImage2D read from it into this texture
+        GLint previousFrameBuffer = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_FRAMEBUFFER_BINDING, &previousFrameBuffer));
+
+        GLuint frameBuffer = 0;
+        glCheck(GLEXT_glGenFramebuffers(1, &frameBuffer));
+
+        if (frameBuffer)
         {
-            err() << "Cannot copy texture, failed to link texture to frame buffer" << std::endl;
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, frameBuffer));
+            glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.m_texture, 0));
+
+            GLenum status;
+            glCheck(status = GLEXT_glCheckFramebufferStatus(GLEXT_GL_FRAMEBUFFER));
+
+            if (status == GLEXT_GL_FRAMEBUFFER_COMPLETE)
+            {
+                // Make sure that the current texture binding will be preserved
+                priv::TextureSaver save;
+
+                glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+
+                if (!texture.m_pixelsFlipped)
+                {
+                    glCheck(glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x, y, 0, 0, texture.m_size.x, texture.m_size.y));
+                }
+                else
+                {
+                    // glCopyTexSubImage2D can't flip, so copy the rows one by one in reverse order
+                    for (unsigned int i = 0; i < texture.m_size.y; ++i)
+                        glCheck(glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x, y + i, 0, texture.m_size.y - 1 - i, texture.m_size.x, 1));
+                }
+
+                copied = true;
+            }
+
+            glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, previousFrameBuffer));
+            glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
         }
+    }
 
-        // Restore previously bound framebuffers
-        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_READ_FRAMEBUFFER, readFramebuffer));
-        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, drawFramebuffer));
+    if (!copied)
+    {
+        // Slow path: read the pixels back to system memory and upload them again
+        update(texture.copyToImage(), x, y);
+        return;
+    }
 
-        // Delete the framebuffers
-        glCheck(GLEXT_glDeleteFramebuffers(1, &sourceFrameBuffer));
-        glCheck(GLEXT_glDeleteFramebuffers(1, &destFrameBuffer));
+    {
+        TransientContextLock lock;
 
         // Make sure that the current texture binding will be preserved
         priv::TextureSaver save;
@@ -546,13 +606,7 @@ void Texture::update(const Texture& texture, unsigned int x, unsigned int y)
         // Force an OpenGL flush, so that the texture data will appear updated
         // in all contexts immediately (solves problems in multi-threaded apps)
         glCheck(glFlush());
-
-        return;
     }
-
-#endif // SFML_OPENGL_ES
-
-    update(texture.copyToImage(), x, y);
 }
 
 
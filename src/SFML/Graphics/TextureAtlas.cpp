@@ -0,0 +1,622 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureAtlas.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/Thread.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+
+
+namespace
+{
+    // Destination of the pixels of an image in a page
+    struct Placement
+    {
+        const sf::Image* image;
+        sf::Uint8*       pixels;
+        unsigned int     x;
+        unsigned int     y;
+    };
+
+    // Copies a range of images to their pages, with their padding.
+    // Images never overlap, so ranges can be processed concurrently.
+    struct Blitter
+    {
+        Blitter(const Placement* placements, std::size_t first, std::size_t last, unsigned int pageWidth, unsigned int padding, bool extrude) :
+        placements(placements),
+        first     (first),
+        last      (last),
+        pageWidth (pageWidth),
+        padding   (padding),
+        extrude   (extrude)
+        {
+        }
+
+        void operator ()() const
+        {
+            const std::size_t pitch = static_cast<std::size_t>(pageWidth) * 4;
+            const int pad = static_cast<int>(padding);
+
+            for (std::size_t i = first; i < last; ++i)
+            {
+                const Placement& placement = placements[i];
+                const int width = static_cast<int>(placement.image->getSize().x);
+                const int height = static_cast<int>(placement.image->getSize().y);
+                if ((width == 0) || (height == 0))
+                    continue;
+
+                const sf::Uint8* source = placement.image->getPixelsPtr();
+                const std::size_t rowSize = static_cast<std::size_t>(width) * 4;
+
+                for (int row = -pad; row < height + pad; ++row)
+                {
+                    // Rows of the padding repeat the first or last row of the image
+                    int sourceRow = row;
+                    if ((row < 0) || (row >= height))
+                    {
+                        if (!extrude)
+                            continue;
+
+                        sourceRow = (row < 0) ? 0 : height - 1;
+                    }
+
+                    const sf::Uint8* src = source + sourceRow * rowSize;
+                    sf::Uint8* dest = placement.pixels + (placement.y + row) * pitch + placement.x * 4;
+
+                    std::memcpy(dest, src, rowSize);
+
+                    // Columns of the padding repeat the first or last pixel of the row
+                    if (extrude)
+                    {
+                        for (int p = 1; p <= pad; ++p)
+                        {
+                            std::memcpy(dest - p * 4, src, 4);
+                            std::memcpy(dest + rowSize + (p - 1) * 4, src + rowSize - 4, 4);
+                        }
+                    }
+                }
+            }
+        }
+
+        const Placement* placements;
+        std::size_t      first;
+        std::size_t      last;
+        unsigned int     pageWidth;
+        unsigned int     padding;
+        bool             extrude;
+    };
+
+    // Orders image indices from the tallest image to the smallest one
+    struct TallerFirst
+    {
+        TallerFirst(const sf::Image* images) : images(images) {}
+
+        bool operator ()(std::size_t left, std::size_t right) const
+        {
+            return images[left].getSize().y > images[right].getSize().y;
+        }
+
+        const sf::Image* images;
+    };
+
+    // Check that the range [position, position + size) lies within [0, limit]
+    bool isInRange(int position, int size, unsigned int limit)
+    {
+        return (position >= 0) && (size >= 0) &&
+               (static_cast<unsigned int>(position) <= limit) &&
+               (static_cast<unsigned int>(size) <= limit - static_cast<unsigned int>(position));
+    }
+
+    // Get the name of the file where a page of an atlas is saved
+    std::string getPageFilename(const std::string& filename, std::size_t page)
+    {
+        std::ostringstream stream;
+        stream << filename << "." << page << ".png";
+        return stream.str();
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas() :
+m_pageSize(2048, 2048),
+m_padding (1),
+m_extrude (true),
+m_isSmooth(false),
+m_pages   (),
+m_entries ()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::~TextureAtlas()
+{
+    cleanup();
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::create(const Vector2u& pageSize, unsigned int padding, bool extrude)
+{
+    // Check if the page can hold at least a 1x1 image with its padding
+    if ((pageSize.x <= padding * 2) || (pageSize.y <= padding * 2))
+    {
+        err() << "Failed to create texture atlas, invalid page size (" << pageSize.x << "x" << pageSize.y
+              << " with a padding of " << padding << ")" << std::endl;
+        return false;
+    }
+
+    cleanup();
+
+    m_pageSize = pageSize;
+    m_padding  = padding;
+    m_extrude  = extrude;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::add(const Image& image)
+{
+    return add(&image, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::add(const Image* images, std::size_t count)
+{
+    // Check that all the images fit in a page before adding any of them
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Vector2u size = images[i].getSize();
+        if ((size.x + m_padding * 2 > m_pageSize.x) || (size.y + m_padding * 2 > m_pageSize.y))
+        {
+            err() << "Failed to add image to texture atlas, image is too large (" << size.x << "x" << size.y
+                  << ", page size is " << m_pageSize.x << "x" << m_pageSize.y << ")" << std::endl;
+            return false;
+        }
+    }
+
+    // Pack the images from the tallest to the smallest, which leaves less free space in the pages
+    std::vector<std::size_t> order(count);
+    for (std::size_t i = 0; i < count; ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), TallerFirst(images));
+
+    std::size_t first = m_entries.size();
+    m_entries.resize(first + count);
+    std::vector<Placement> placements(count);
+
+    for (std::vector<std::size_t>::const_iterator it = order.begin(); it != order.end(); ++it)
+    {
+        Vector2u size = images[*it].getSize();
+        unsigned int width = std::max(size.x + m_padding * 2, 1u);
+        unsigned int height = std::max(size.y + m_padding * 2, 1u);
+
+        // Use the first page which has room for the image, or a new one
+        unsigned int x = 0;
+        unsigned int y = 0;
+        std::size_t index = 0;
+        while ((index < m_pages.size()) && !insert(*m_pages[index], width, height, x, y))
+            ++index;
+
+        if (index == m_pages.size())
+            insert(addPage(), width, height, x, y);
+
+        Page& page = *m_pages[index];
+        page.dirtyTop = std::min(page.dirtyTop, y);
+        page.dirtyBottom = std::max(page.dirtyBottom, y + height);
+
+        Entry& entry = m_entries[first + *it];
+        entry.page = index;
+        entry.rect = IntRect(x + m_padding, y + m_padding, size.x, size.y);
+
+        Placement& placement = placements[*it];
+        placement.image = &images[*it];
+        placement.pixels = &page.pixels[0];
+        placement.x = x + m_padding;
+        placement.y = y + m_padding;
+    }
+
+    // Copy the pixels to the pages, in parallel for large batches
+    const unsigned int threadCount = (count >= 64) ? 4 : 1;
+    const std::size_t band = count / threadCount;
+
+    std::vector<Thread*> threads;
+    for (unsigned int i = 1; i < threadCount; ++i)
+    {
+        std::size_t last = (i + 1 < threadCount) ? (i + 1) * band : count;
+        threads.push_back(new Thread(Blitter(&placements[0], i * band, last, m_pageSize.x, m_padding, m_extrude)));
+        threads.back()->launch();
+    }
+
+    if (count > 0)
+        Blitter(&placements[0], 0, band, m_pageSize.x, m_padding, m_extrude)();
+
+    for (std::vector<Thread*>::iterator it = threads.begin(); it != threads.end(); ++it)
+    {
+        (*it)->wait();
+        delete *it;
+    }
+
+    return uploadPages();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getImageCount() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getTexture(std::size_t index) const
+{
+    return m_pages[m_entries[index].page]->texture;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect TextureAtlas::getTextureRect(std::size_t index) const
+{
+    return m_entries[index].rect;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureAtlas::getPageCount() const
+{
+    return m_pages.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::setSmooth(bool smooth)
+{
+    m_isSmooth = smooth;
+
+    for (std::vector<Page*>::iterator it = m_pages.begin(); it != m_pages.end(); ++it)
+        (*it)->texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::saveToFile(const std::string& filename) const
+{
+    std::ofstream file(filename.c_str());
+    if (!file)
+    {
+        err() << "Failed to save texture atlas \"" << filename << "\" (cannot open file)" << std::endl;
+        return false;
+    }
+
+    // Write the layout: settings, outline of each page and location of each image
+    file << "sfml-texture-atlas 1\n";
+    file << m_pageSize.x << ' ' << m_pageSize.y << ' ' << m_padding << ' ' << (m_extrude ? 1 : 0) << '\n';
+
+    file << m_pages.size() << '\n';
+    for (std::vector<Page*>::const_iterator it = m_pages.begin(); it != m_pages.end(); ++it)
+    {
+        const std::vector<Segment>& skyline = (*it)->skyline;
+
+        file << skyline.size();
+        for (std::vector<Segment>::const_iterator segment = skyline.begin(); segment != skyline.end(); ++segment)
+            file << ' ' << segment->x << ' ' << segment->y << ' ' << segment->width;
+        file << '\n';
+    }
+
+    file << m_entries.size() << '\n';
+    for (std::vector<Entry>::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+        file << it->page << ' ' << it->rect.left << ' ' << it->rect.top << ' ' << it->rect.width << ' ' << it->rect.height << '\n';
+
+    if (!file)
+    {
+        err() << "Failed to save texture atlas \"" << filename << "\" (write error)" << std::endl;
+        return false;
+    }
+
+    // Write the pages
+    for (std::size_t i = 0; i < m_pages.size(); ++i)
+    {
+        Image image;
+        image.create(m_pageSize.x, m_pageSize.y, &m_pages[i]->pixels[0]);
+
+        if (!image.saveToFile(getPageFilename(filename, i)))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::loadFromFile(const std::string& filename)
+{
+    std::ifstream file(filename.c_str());
+    if (!file)
+    {
+        err() << "Failed to load texture atlas \"" << filename << "\" (cannot open file)" << std::endl;
+        return false;
+    }
+
+    // Read the settings
+    std::string magic;
+    int version = 0;
+    Vector2u pageSize;
+    unsigned int padding = 0;
+    int extrude = 0;
+    std::size_t pageCount = 0;
+    file >> magic >> version >> pageSize.x >> pageSize.y >> padding >> extrude >> pageCount;
+
+    bool valid = file && (magic == "sfml-texture-atlas") && (version == 1) &&
+                 (pageSize.x > 0) && (padding <= (pageSize.x - 1) / 2) &&
+                 (pageSize.y > 0) && (padding <= (pageSize.y - 1) / 2);
+
+    // Read the pages
+    std::vector<Page*> pages;
+    for (std::size_t i = 0; valid && (i < pageCount); ++i)
+    {
+        Page* page = new Page;
+        pages.push_back(page);
+
+        // The skyline must cover the width of the page with contiguous
+        // segments, which is what insert() relies on when walking it
+        std::size_t segmentCount = 0;
+        file >> segmentCount;
+
+        unsigned int right = 0;
+        for (std::size_t j = 0; valid && file && (j < segmentCount); ++j)
+        {
+            Segment segment;
+            file >> segment.x >> segment.y >> segment.width;
+            valid = (segment.x == right) && (segment.width > 0) && (segment.width <= pageSize.x - right) &&
+                    (segment.y <= pageSize.y);
+            right += segment.width;
+            page->skyline.push_back(segment);
+        }
+
+        Image image;
+        valid = valid && file && (right == pageSize.x) &&
+                image.loadFromFile(getPageFilename(filename, i)) && (image.getSize() == pageSize);
+
+        if (valid)
+        {
+            const Uint8* pixels = image.getPixelsPtr();
+            page->pixels.assign(pixels, pixels + pageSize.x * pageSize.y * 4);
+            page->dirtyTop = 0;
+            page->dirtyBottom = pageSize.y;
+        }
+    }
+
+    // Read the location of the images
+    std::size_t entryCount = 0;
+    if (valid)
+        file >> entryCount;
+
+    std::vector<Entry> entries;
+    for (std::size_t i = 0; valid && (i < entryCount); ++i)
+    {
+        Entry entry;
+        file >> entry.page >> entry.rect.left >> entry.rect.top >> entry.rect.width >> entry.rect.height;
+        valid = file && (entry.page < pageCount) &&
+                isInRange(entry.rect.left, entry.rect.width, pageSize.x) &&
+                isInRange(entry.rect.top, entry.rect.height, pageSize.y);
+        entries.push_back(entry);
+    }
+
+    if (!valid)
+    {
+        for (std::vector<Page*>::iterator it = pages.begin(); it != pages.end(); ++it)
+            delete *it;
+
+        err() << "Failed to load texture atlas \"" << filename << "\" (invalid or incomplete layout)" << std::endl;
+        return false;
+    }
+
+    // Create the textures before touching the current contents, so
+    // that the atlas is left unchanged if one of them can't be created
+    for (std::vector<Page*>::iterator it = pages.begin(); valid && (it != pages.end()); ++it)
+        valid = uploadPage(**it, pageSize);
+
+    if (!valid)
+    {
+        for (std::vector<Page*>::iterator it = pages.begin(); it != pages.end(); ++it)
+            delete *it;
+
+        err() << "Failed to load texture atlas \"" << filename << "\" (cannot create the page textures)" << std::endl;
+        return false;
+    }
+
+    // Everything was loaded successfully, replace the current contents
+    cleanup();
+
+    m_pageSize = pageSize;
+    m_padding  = padding;
+    m_extrude  = (extrude != 0);
+    m_pages.swap(pages);
+    m_entries.swap(entries);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::insert(Page& page, unsigned int width, unsigned int height, unsigned int& x, unsigned int& y) const
+{
+    std::vector<Segment>& skyline = page.skyline;
+
+    // Find the lowest position along the outline where the rectangle fits (bottom-left rule)
+    std::size_t best = skyline.size();
+    unsigned int bestY = 0;
+    for (std::size_t i = 0; i < skyline.size(); ++i)
+    {
+        // Segments are sorted from left to right, so the next ones won't fit either
+        if (skyline[i].x + width > m_pageSize.x)
+            break;
+
+        // The rectangle rests on the highest segment below it
+        unsigned int top = 0;
+        unsigned int remaining = width;
+        for (std::size_t j = i; remaining > 0; ++j)
+        {
+            top = std::max(top, skyline[j].y);
+            remaining -= std::min(remaining, skyline[j].width);
+        }
+
+        if ((top + height <= m_pageSize.y) && ((best == skyline.size()) || (top < bestY)))
+        {
+            best = i;
+            bestY = top;
+        }
+    }
+
+    if (best == skyline.size())
+        return false;
+
+    x = skyline[best].x;
+    y = bestY;
+
+    // Raise the outline where the rectangle was placed
+    Segment segment = {x, y + height, width};
+    skyline.insert(skyline.begin() + best, segment);
+
+    for (std::size_t i = best + 1; i < skyline.size();)
+    {
+        unsigned int right = x + width;
+        if (skyline[i].x >= right)
+            break;
+
+        unsigned int overlap = right - skyline[i].x;
+        if (overlap < skyline[i].width)
+        {
+            skyline[i].x += overlap;
+            skyline[i].width -= overlap;
+            break;
+        }
+
+        skyline.erase(skyline.begin() + i);
+    }
+
+    // Merge the neighbour segments that are at the same height
+    for (std::size_t i = 0; i + 1 < skyline.size();)
+    {
+        if (skyline[i].y == skyline[i + 1].y)
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::Page& TextureAtlas::addPage()
+{
+    Page* page = new Page;
+
+    Segment segment = {0, 0, m_pageSize.x};
+    page->skyline.push_back(segment);
+    page->pixels.resize(static_cast<std::size_t>(m_pageSize.x) * m_pageSize.y * 4, 0);
+    page->dirtyTop = 0;
+    page->dirtyBottom = m_pageSize.y;
+
+    m_pages.push_back(page);
+
+    return *page;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::uploadPage(Page& page, const Vector2u& pageSize) const
+{
+    if (page.dirtyTop >= page.dirtyBottom)
+        return true;
+
+    // New pages get their texture and are uploaded entirely
+    if (page.texture.getSize() != pageSize)
+    {
+        // The page stays dirty, so that the upload is retried later
+        if (!page.texture.create(pageSize.x, pageSize.y))
+            return false;
+
+        page.texture.setSmooth(m_isSmooth);
+        page.dirtyTop = 0;
+        page.dirtyBottom = pageSize.y;
+    }
+
+    // The modified rows are contiguous in memory, so they can be uploaded in a single call
+    const Uint8* pixels = &page.pixels[static_cast<std::size_t>(page.dirtyTop) * pageSize.x * 4];
+    page.texture.update(pixels, pageSize.x, page.dirtyBottom - page.dirtyTop, 0, page.dirtyTop);
+
+    page.dirtyTop = pageSize.y;
+    page.dirtyBottom = 0;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::uploadPages()
+{
+    // Keep uploading the other pages if one of them fails
+    bool success = true;
+    for (std::vector<Page*>::iterator it = m_pages.begin(); it != m_pages.end(); ++it)
+    {
+        if (!uploadPage(**it, m_pageSize))
+            success = false;
+    }
+
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::cleanup()
+{
+    for (std::vector<Page*>::iterator it = m_pages.begin(); it != m_pages.end(); ++it)
+        delete *it;
+
+    m_pages.clear();
+    m_entries.clear();
+}
+
+} // namespace sf
@@ -0,0 +1,311 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureReadback.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/TextureSaver.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Err.hpp>
+#include <cstring>
+
+
+namespace
+{
+    sf::Mutex isAvailableMutex;
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback() :
+m_buffer    (0),
+m_bufferSize(0),
+m_sync      (NULL),
+m_size      (0, 0),
+m_actualSize(0, 0),
+m_flipped   (false),
+m_pending   (false)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::~TextureReadback()
+{
+    releaseSync();
+
+#ifndef SFML_OPENGL_ES
+
+    if (m_buffer)
+    {
+        TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::request(const Texture& texture)
+{
+    if (!texture.m_texture)
+        return false;
+
+    releaseSync();
+    m_pending = false;
+
+    if (!isAvailable())
+    {
+        // Synchronous fallback
+        m_image = texture.copyToImage();
+        m_pending = true;
+        return true;
+    }
+
+#ifndef SFML_OPENGL_ES
+
+    TransientContextLock contextLock;
+
+    // The whole storage of the texture is transferred, padding
+    // and flipping are handled when the pixels are fetched
+    m_size       = texture.m_size;
+    m_actualSize = texture.m_actualSize;
+    m_flipped    = texture.m_pixelsFlipped;
+
+    GLint previousBuffer = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_PIXEL_PACK_BUFFER_BINDING, &previousBuffer));
+
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create pixel buffer, generation failed" << std::endl;
+        return false;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, m_buffer));
+
+    // Reuse the storage of the previous request when it is large enough
+    std::size_t size = static_cast<std::size_t>(m_actualSize.x) * m_actualSize.y * 4;
+    if (size > m_bufferSize)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER, size, NULL, GLEXT_GL_STREAM_READ));
+        m_bufferSize = size;
+    }
+
+    {
+        // Make sure that the current texture binding will be preserved
+        priv::TextureSaver save;
+
+        // With a pixel pack buffer bound, the last argument is an offset into the buffer
+        // and the call returns without waiting for the pixels
+        glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
+        glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL));
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, static_cast<GLuint>(previousBuffer)));
+
+    if (GLEXT_sync)
+        glCheck(m_sync = GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    // Submit the commands now, so that the transfer (and the fence) can
+    // complete while the application keeps rendering, possibly in another context
+    glCheck(glFlush());
+
+    m_pending = true;
+    return true;
+
+#else
+
+    return false;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::isPending() const
+{
+    return m_pending;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::isReady() const
+{
+    if (!m_pending)
+        return false;
+
+#ifndef SFML_OPENGL_ES
+
+    if (m_sync)
+    {
+        TransientContextLock contextLock;
+
+        GLenum status;
+        glCheck(status = GLEXT_glClientWaitSync(static_cast<GLsync>(m_sync), 0, 0));
+
+        return (status == GLEXT_GL_ALREADY_SIGNALED) || (status == GLEXT_GL_CONDITION_SATISFIED);
+    }
+
+#endif // SFML_OPENGL_ES
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::fetch(Image& image)
+{
+    if (!m_pending)
+        return false;
+
+    m_pending = false;
+
+    if (!m_buffer)
+    {
+        // The request was performed synchronously
+        image = m_image;
+        m_image = Image();
+        return true;
+    }
+
+#ifndef SFML_OPENGL_ES
+
+    releaseSync();
+
+    TransientContextLock contextLock;
+
+    GLint previousBuffer = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_PIXEL_PACK_BUFFER_BINDING, &previousBuffer));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, m_buffer));
+
+    // Mapping the buffer waits for the transfer if it is still in progress
+    const Uint8* pixels = NULL;
+    glCheck(pixels = static_cast<const Uint8*>(GLEXT_glMapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, GLEXT_GL_READ_ONLY)));
+
+    if (pixels)
+    {
+        if ((m_size == m_actualSize) && !m_flipped)
+        {
+            // Texture is not padded nor flipped, we can use a direct copy
+            image.create(m_size.x, m_size.y, pixels);
+        }
+        else
+        {
+            // Copy the useful pixels to a temporary array
+            m_pixels.resize(static_cast<std::size_t>(m_size.x) * m_size.y * 4);
+
+            const Uint8* src = pixels;
+            Uint8* dst = &m_pixels[0];
+            int srcPitch = m_actualSize.x * 4;
+            int dstPitch = m_size.x * 4;
+
+            // Handle the case where source pixels are flipped vertically
+            if (m_flipped)
+            {
+                src += srcPitch * (m_size.y - 1);
+                srcPitch = -srcPitch;
+            }
+
+            for (unsigned int i = 0; i < m_size.y; ++i)
+            {
+                std::memcpy(dst, src, dstPitch);
+                src += srcPitch;
+                dst += dstPitch;
+            }
+
+            image.create(m_size.x, m_size.y, &m_pixels[0]);
+        }
+
+        glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+    }
+    else
+    {
+        err() << "Could not fetch texture pixels, failed to map the pixel buffer" << std::endl;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, static_cast<GLuint>(previousBuffer)));
+
+    return pixels != NULL;
+
+#else
+
+    return false;
+
+#endif // SFML_OPENGL_ES
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::isAvailable()
+{
+    Lock lock(isAvailableMutex);
+
+    static bool checked = false;
+    static bool available = false;
+
+    if (!checked)
+    {
+        checked = true;
+
+        TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        available = GLEXT_vertex_buffer_object && GLEXT_pixel_buffer_object;
+    }
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureReadback::releaseSync()
+{
+#ifndef SFML_OPENGL_ES
+
+    if (m_sync)
+    {
+        TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteSync(static_cast<GLsync>(m_sync)));
+        m_sync = NULL;
+    }
+
+#endif // SFML_OPENGL_ES
+}
+
+} // namespace sf
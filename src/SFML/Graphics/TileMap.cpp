@@ -0,0 +1,308 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TileMap.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+    // Number of vertices used to draw a tile (two triangles,
+    // since quads are not available on every platform)
+    const std::size_t verticesPerTile = 6;
+
+    // Compute the range of chunks [begin, end) covering [start, start + length]
+    // along one axis, clamped to the size of the map
+    void getChunkRange(float start, float length, float chunkLength, unsigned int chunkCount, unsigned int& begin, unsigned int& end)
+    {
+        float first = std::floor(start / chunkLength);
+        float last  = std::floor((start + length) / chunkLength);
+
+        if ((last < 0.f) || (first >= static_cast<float>(chunkCount)))
+        {
+            begin = end = 0;
+            return;
+        }
+
+        begin = (first < 0.f) ? 0 : static_cast<unsigned int>(first);
+        end   = (last >= static_cast<float>(chunkCount)) ? chunkCount : static_cast<unsigned int>(last) + 1;
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+const Uint32 TileMap::NoTile = 0xFFFFFFFF;
+
+
+////////////////////////////////////////////////////////////
+TileMap::Chunk::Chunk() :
+buffer     (Triangles, VertexBuffer::Static),
+vertices   (),
+vertexCount(0),
+needsUpdate(true)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::TileMap() :
+m_tiles         (),
+m_chunks        (),
+m_vertices      (),
+m_texture       (NULL),
+m_tilesetColumns(0),
+m_mapSize       (0, 0),
+m_tileSize      (0, 0),
+m_chunkSize     (0),
+m_chunkCount    (0, 0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool TileMap::create(const Vector2u& mapSize, const Vector2u& tileSize, unsigned int chunkSize)
+{
+    // Check if all the parameters are valid before doing anything
+    if ((mapSize.x == 0) || (mapSize.y == 0) || (tileSize.x == 0) || (tileSize.y == 0) || (chunkSize == 0))
+    {
+        err() << "Failed to create tile map, invalid size (" << mapSize.x << "x" << mapSize.y
+              << " tiles of " << tileSize.x << "x" << tileSize.y << ", chunks of " << chunkSize << ")" << std::endl;
+        return false;
+    }
+
+    m_mapSize    = mapSize;
+    m_tileSize   = tileSize;
+    m_chunkSize  = chunkSize;
+    m_chunkCount = Vector2u((mapSize.x + chunkSize - 1) / chunkSize, (mapSize.y + chunkSize - 1) / chunkSize);
+
+    // Start with an empty map; the chunks create their vertex buffers when they are first drawn
+    std::vector<Uint32>(static_cast<std::size_t>(mapSize.x) * mapSize.y, NoTile).swap(m_tiles);
+    std::vector<Chunk>(static_cast<std::size_t>(m_chunkCount.x) * m_chunkCount.y).swap(m_chunks);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTexture(const Texture& texture)
+{
+    m_texture = &texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* TileMap::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(unsigned int x, unsigned int y, Uint32 tile)
+{
+    Uint32& cell = m_tiles[static_cast<std::size_t>(y) * m_mapSize.x + x];
+
+    if (cell != tile)
+    {
+        cell = tile;
+        m_chunks[(y / m_chunkSize) * m_chunkCount.x + x / m_chunkSize].needsUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Uint32 TileMap::getTile(unsigned int x, unsigned int y) const
+{
+    return m_tiles[static_cast<std::size_t>(y) * m_mapSize.x + x];
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2u& TileMap::getMapSize() const
+{
+    return m_mapSize;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2u& TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TileMap::getChunkSize() const
+{
+    return m_chunkSize;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    float width = static_cast<float>(m_mapSize.x * m_tileSize.x);
+    float height = static_cast<float>(m_mapSize.y * m_tileSize.y);
+
+    return FloatRect(0.f, 0.f, width, height);
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, RenderStates states) const
+{
+    if (!m_texture || m_chunks.empty())
+        return;
+
+    states.transform *= getTransform();
+    states.texture = m_texture;
+
+    // If the layout of the tileset changed, the texture coordinates of all the chunks must be recomputed
+    unsigned int tilesetColumns = std::max(m_texture->getSize().x / m_tileSize.x, 1u);
+    if (tilesetColumns != m_tilesetColumns)
+    {
+        m_tilesetColumns = tilesetColumns;
+        for (std::vector<Chunk>::iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+            it->needsUpdate = true;
+    }
+
+    // Find the area covered by the view, in the local coordinate system of the map
+    FloatRect area = target.getView().getInverseTransform().transformRect(FloatRect(-1.f, -1.f, 2.f, 2.f));
+    area = states.transform.getInverse().transformRect(area);
+
+    unsigned int beginX, endX, beginY, endY;
+    getChunkRange(area.left, area.width, static_cast<float>(m_chunkSize * m_tileSize.x), m_chunkCount.x, beginX, endX);
+    getChunkRange(area.top, area.height, static_cast<float>(m_chunkSize * m_tileSize.y), m_chunkCount.y, beginY, endY);
+
+    // Update and draw the visible chunks only
+    bool useBuffer = VertexBuffer::isAvailable();
+
+    for (unsigned int y = beginY; y < endY; ++y)
+    {
+        for (unsigned int x = beginX; x < endX; ++x)
+        {
+            Chunk& chunk = m_chunks[y * m_chunkCount.x + x];
+
+            if (chunk.needsUpdate)
+                updateChunk(x, y, useBuffer);
+
+            if (chunk.vertexCount == 0)
+                continue;
+
+            if (useBuffer)
+                target.draw(chunk.buffer, 0, chunk.vertexCount, states);
+            else
+                target.draw(&chunk.vertices[0], chunk.vertexCount, Triangles, states);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool TileMap::getCullingBounds(FloatRect& bounds) const
+{
+    bounds = getGlobalBounds();
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::updateChunk(unsigned int chunkX, unsigned int chunkY, bool useBuffer) const
+{
+    Chunk& chunk = m_chunks[chunkY * m_chunkCount.x + chunkX];
+    std::vector<Vertex>& vertices = useBuffer ? m_vertices : chunk.vertices;
+
+    unsigned int beginX = chunkX * m_chunkSize;
+    unsigned int beginY = chunkY * m_chunkSize;
+    unsigned int endX   = std::min(beginX + m_chunkSize, m_mapSize.x);
+    unsigned int endY   = std::min(beginY + m_chunkSize, m_mapSize.y);
+
+    vertices.resize(static_cast<std::size_t>(endX - beginX) * (endY - beginY) * verticesPerTile);
+
+    float tileWidth  = static_cast<float>(m_tileSize.x);
+    float tileHeight = static_cast<float>(m_tileSize.y);
+
+    // Build two triangles for each non-empty tile
+    std::size_t count = 0;
+    for (unsigned int y = beginY; y < endY; ++y)
+    {
+        const Uint32* row = &m_tiles[static_cast<std::size_t>(y) * m_mapSize.x];
+
+        for (unsigned int x = beginX; x < endX; ++x)
+        {
+            Uint32 tile = row[x];
+            if (tile == NoTile)
+                continue;
+
+            float left   = x * tileWidth;
+            float top    = y * tileHeight;
+            float right  = left + tileWidth;
+            float bottom = top + tileHeight;
+
+            float u = (tile % m_tilesetColumns) * tileWidth;
+            float v = (tile / m_tilesetColumns) * tileHeight;
+
+            Vertex* quad = &vertices[count];
+            quad[0] = Vertex(Vector2f(left,  top),    Vector2f(u,             v));
+            quad[1] = Vertex(Vector2f(right, top),    Vector2f(u + tileWidth, v));
+            quad[2] = Vertex(Vector2f(left,  bottom), Vector2f(u,             v + tileHeight));
+            quad[3] = quad[2];
+            quad[4] = quad[1];
+            quad[5] = Vertex(Vector2f(right, bottom), Vector2f(u + tileWidth, v + tileHeight));
+
+            count += verticesPerTile;
+        }
+    }
+
+    // Send the geometry to the graphics card; the buffer only grows, so that
+    // a chunk whose tiles are frequently changed doesn't keep reallocating it
+    if (useBuffer && (count > 0))
+    {
+        bool uploaded = (count <= chunk.buffer.getVertexCount()) || chunk.buffer.create(count);
+
+        if (!uploaded || !chunk.buffer.update(&vertices[0], count, 0))
+            count = 0;
+    }
+
+    chunk.vertexCount = count;
+    chunk.needsUpdate = false;
+}
+
+} // namespace sf
@@ -26,6 +26,9 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Simd.hpp>
+#include <algorithm>
 #include <cmath>
 
 
@@ -110,31 +113,121 @@ Vector2f Transform::transformPoint(const Vector2f& point) const
 
 
 ////////////////////////////////////////////////////////////
-FloatRect Transform::transformRect(const FloatRect& rectangle) const
+void Transform::transformPoints(const Vector2f* points, Vector2f* result, std::size_t count) const
+{
+    const float* m = m_matrix;
+    std::size_t i = 0;
+
+#if defined(SFML_SIMD_SSE2)
+
+    // Two points per register: (x0, y0, x1, y1)
+    const __m128 column0     = _mm_setr_ps(m[0], m[1], m[0], m[1]);
+    const __m128 column1     = _mm_setr_ps(m[4], m[5], m[4], m[5]);
+    const __m128 translation = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 p = _mm_loadu_ps(&points[i].x);
+        __m128 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+        _mm_storeu_ps(&result[i].x, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, column0), _mm_mul_ps(y, column1)), translation));
+    }
+
+#elif defined(SFML_SIMD_NEON)
+
+    const float c0[2] = {m[0], m[1]};
+    const float c1[2] = {m[4], m[5]};
+    const float t[2]  = {m[12], m[13]};
+    const float32x2_t column0     = vld1_f32(c0);
+    const float32x2_t column1     = vld1_f32(c1);
+    const float32x2_t translation = vld1_f32(t);
+
+    for (; i < count; ++i)
+    {
+        float32x2_t p = vadd_f32(vmul_n_f32(column0, points[i].x), vmul_n_f32(column1, points[i].y));
+        vst1_f32(&result[i].x, vadd_f32(p, translation));
+    }
+
+#endif
+
+    // Remaining points (or all of them if no vector instructions are available)
+    for (; i < count; ++i)
+        result[i] = transformPoint(points[i].x, points[i].y);
+}
+
+
+////////////////////////////////////////////////////////////
+void Transform::transformVertices(Vertex* vertices, std::size_t count) const
 {
-    // Transform the 4 corners of the rectangle
-    const Vector2f points[] =
+    const float* m = m_matrix;
+    std::size_t i = 0;
+
+#if defined(SFML_SIMD_SSE2)
+
+    // Two positions per register, loaded and stored as 64-bit halves
+    const __m128 column0     = _mm_setr_ps(m[0], m[1], m[0], m[1]);
+    const __m128 column1     = _mm_setr_ps(m[4], m[5], m[4], m[5]);
+    const __m128 translation = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+
+    for (; i + 2 <= count; i += 2)
     {
-        transformPoint(rectangle.left, rectangle.top),
-        transformPoint(rectangle.left, rectangle.top + rectangle.height),
-        transformPoint(rectangle.left + rectangle.width, rectangle.top),
-        transformPoint(rectangle.left + rectangle.width, rectangle.top + rectangle.height)
-    };
-
-    // Compute the bounding rectangle of the transformed points
-    float left = points[0].x;
-    float top = points[0].y;
-    float right = points[0].x;
-    float bottom = points[0].y;
-    for (int i = 1; i < 4; ++i)
+        __m64* first  = reinterpret_cast<__m64*>(&vertices[i].position);
+        __m64* second = reinterpret_cast<__m64*>(&vertices[i + 1].position);
+
+        __m128 p = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), first), second);
+        __m128 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+        __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, column0), _mm_mul_ps(y, column1)), translation);
+
+        _mm_storel_pi(first, r);
+        _mm_storeh_pi(second, r);
+    }
+
+#elif defined(SFML_SIMD_NEON)
+
+    const float c0[2] = {m[0], m[1]};
+    const float c1[2] = {m[4], m[5]};
+    const float t[2]  = {m[12], m[13]};
+    const float32x2_t column0     = vld1_f32(c0);
+    const float32x2_t column1     = vld1_f32(c1);
+    const float32x2_t translation = vld1_f32(t);
+
+    for (; i < count; ++i)
     {
-        if      (points[i].x < left)   left = points[i].x;
-        else if (points[i].x > right)  right = points[i].x;
-        if      (points[i].y < top)    top = points[i].y;
-        else if (points[i].y > bottom) bottom = points[i].y;
+        Vector2f& position = vertices[i].position;
+        float32x2_t p = vadd_f32(vmul_n_f32(column0, position.x), vmul_n_f32(column1, position.y));
+        vst1_f32(&position.x, vadd_f32(p, translation));
     }
 
-    return FloatRect(left, top, right - left, bottom - top);
+#endif
+
+    // Remaining vertices (or all of them if no vector instructions are available)
+    for (; i < count; ++i)
+        vertices[i].position = transformPoint(vertices[i].position.x, vertices[i].position.y);
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect Transform::transformRect(const FloatRect& rectangle) const
+{
+    // Each coordinate of a transformed corner is the sum of one term per
+    // source coordinate, so the extremes can be computed per term instead
+    // of transforming the 4 corners
+    const float* m = m_matrix;
+    const float right  = rectangle.left + rectangle.width;
+    const float bottom = rectangle.top + rectangle.height;
+
+    const float xx0 = m[0] * rectangle.left, xx1 = m[0] * right;
+    const float xy0 = m[4] * rectangle.top,  xy1 = m[4] * bottom;
+    const float yx0 = m[1] * rectangle.left, yx1 = m[1] * right;
+    const float yy0 = m[5] * rectangle.top,  yy1 = m[5] * bottom;
+
+    const float minX = std::min(xx0, xx1) + std::min(xy0, xy1) + m[12];
+    const float maxX = std::max(xx0, xx1) + std::max(xy0, xy1) + m[12];
+    const float minY = std::min(yx0, yx1) + std::min(yy0, yy1) + m[13];
+    const float maxY = std::max(yx0, yx1) + std::max(yy0, yy1) + m[13];
+
+    return FloatRect(minX, minY, maxX - minX, maxY - minY);
 }
 
 
@@ -144,15 +237,32 @@ Transform& Transform::combine(const Transform& transform)
     const float* a = m_matrix;
     const float* b = transform.m_matrix;
 
-    *this = Transform(a[0] * b[0]  + a[4] * b[1]  + a[12] * b[3],
-                      a[0] * b[4]  + a[4] * b[5]  + a[12] * b[7],
-                      a[0] * b[12] + a[4] * b[13] + a[12] * b[15],
-                      a[1] * b[0]  + a[5] * b[1]  + a[13] * b[3],
-                      a[1] * b[4]  + a[5] * b[5]  + a[13] * b[7],
-                      a[1] * b[12] + a[5] * b[13] + a[13] * b[15],
-                      a[3] * b[0]  + a[7] * b[1]  + a[15] * b[3],
-                      a[3] * b[4]  + a[7] * b[5]  + a[15] * b[7],
-                      a[3] * b[12] + a[7] * b[13] + a[15] * b[15]);
+    if (isAffine() && transform.isAffine())
+    {
+        // The last row of both matrices is (0, 0, 1), so only the
+        // terms that can be different from 0 are computed
+        float a00 = a[0] * b[0]  + a[4] * b[1];
+        float a01 = a[0] * b[4]  + a[4] * b[5];
+        float a02 = a[0] * b[12] + a[4] * b[13] + a[12];
+        float a10 = a[1] * b[0]  + a[5] * b[1];
+        float a11 = a[1] * b[4]  + a[5] * b[5];
+        float a12 = a[1] * b[12] + a[5] * b[13] + a[13];
+
+        m_matrix[0] = a00; m_matrix[4] = a01; m_matrix[12] = a02;
+        m_matrix[1] = a10; m_matrix[5] = a11; m_matrix[13] = a12;
+    }
+    else
+    {
+        *this = Transform(a[0] * b[0]  + a[4] * b[1]  + a[12] * b[3],
+                          a[0] * b[4]  + a[4] * b[5]  + a[12] * b[7],
+                          a[0] * b[12] + a[4] * b[13] + a[12] * b[15],
+                          a[1] * b[0]  + a[5] * b[1]  + a[13] * b[3],
+                          a[1] * b[4]  + a[5] * b[5]  + a[13] * b[7],
+                          a[1] * b[12] + a[5] * b[13] + a[13] * b[15],
+                          a[3] * b[0]  + a[7] * b[1]  + a[15] * b[3],
+                          a[3] * b[4]  + a[7] * b[5]  + a[15] * b[7],
+                          a[3] * b[12] + a[7] * b[13] + a[15] * b[15]);
+    }
 
     return *this;
 }
@@ -161,11 +271,12 @@ Transform& Transform::combine(const Transform& transform)
 ////////////////////////////////////////////////////////////
 Transform& Transform::translate(float x, float y)
 {
-    Transform translation(1, 0, x,
-                          0, 1, y,
-                          0, 0, 1);
+    // Equivalent to combining with a translation matrix, without the terms that are always 0
+    m_matrix[12] = m_matrix[0] * x + m_matrix[4] * y + m_matrix[12];
+    m_matrix[13] = m_matrix[1] * x + m_matrix[5] * y + m_matrix[13];
+    m_matrix[15] = m_matrix[3] * x + m_matrix[7] * y + m_matrix[15];
 
-    return combine(translation);
+    return *this;
 }
 
 
@@ -183,11 +294,19 @@ Transform& Transform::rotate(float angle)
     float cos = std::cos(rad);
     float sin = std::sin(rad);
 
-    Transform rotation(cos, -sin, 0,
-                       sin,  cos, 0,
-                       0,    0,   1);
+    // Equivalent to combining with a rotation matrix, without the terms that are always 0
+    float a00 = m_matrix[0] * cos + m_matrix[4] * sin;
+    float a01 = m_matrix[4] * cos - m_matrix[0] * sin;
+    float a10 = m_matrix[1] * cos + m_matrix[5] * sin;
+    float a11 = m_matrix[5] * cos - m_matrix[1] * sin;
+    float a20 = m_matrix[3] * cos + m_matrix[7] * sin;
+    float a21 = m_matrix[7] * cos - m_matrix[3] * sin;
 
-    return combine(rotation);
+    m_matrix[0] = a00; m_matrix[4] = a01;
+    m_matrix[1] = a10; m_matrix[5] = a11;
+    m_matrix[3] = a20; m_matrix[7] = a21;
+
+    return *this;
 }
 
 
@@ -216,11 +335,12 @@ Transform& Transform::rotate(float angle, const Vector2f& center)
 ////////////////////////////////////////////////////////////
 Transform& Transform::scale(float scaleX, float scaleY)
 {
-    Transform scaling(scaleX, 0,      0,
-                      0,      scaleY, 0,
-                      0,      0,      1);
+    // Equivalent to combining with a scaling matrix, without the terms that are always 0
+    m_matrix[0] *= scaleX; m_matrix[4] *= scaleY;
+    m_matrix[1] *= scaleX; m_matrix[5] *= scaleY;
+    m_matrix[3] *= scaleX; m_matrix[7] *= scaleY;
 
-    return combine(scaling);
+    return *this;
 }
 
 
@@ -249,6 +369,13 @@ Transform& Transform::scale(const Vector2f& factors, const Vector2f& center)
 }
 
 
+////////////////////////////////////////////////////////////
+bool Transform::isAffine() const
+{
+    return (m_matrix[3] == 0.f) && (m_matrix[7] == 0.f) && (m_matrix[15] == 1.f);
+}
+
+
 ////////////////////////////////////////////////////////////
 Transform operator *(const Transform& left, const Transform& right)
 {
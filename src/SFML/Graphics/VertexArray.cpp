@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/System/Simd.hpp>
 
 
 namespace sf
@@ -108,29 +109,7 @@ FloatRect VertexArray::getBounds() const
 {
     if (!m_vertices.empty())
     {
-        float left   = m_vertices[0].position.x;
-        float top    = m_vertices[0].position.y;
-        float right  = m_vertices[0].position.x;
-        float bottom = m_vertices[0].position.y;
-
-        for (std::size_t i = 1; i < m_vertices.size(); ++i)
-        {
-            Vector2f position = m_vertices[i].position;
-
-            // Update left and right
-            if (position.x < left)
-                left = position.x;
-            else if (position.x > right)
-                right = position.x;
-
-            // Update top and bottom
-            if (position.y < top)
-                top = position.y;
-            else if (position.y > bottom)
-                bottom = position.y;
-        }
-
-        return FloatRect(left, top, right - left, bottom - top);
+        return computeBounds(&m_vertices[0], m_vertices.size());
     }
     else
     {
@@ -140,6 +119,87 @@ FloatRect VertexArray::getBounds() const
 }
 
 
+////////////////////////////////////////////////////////////
+FloatRect VertexArray::computeBounds(const Vertex* vertices, std::size_t count)
+{
+    if (count == 0)
+        return FloatRect();
+
+    float left   = vertices[0].position.x;
+    float top    = vertices[0].position.y;
+    float right  = vertices[0].position.x;
+    float bottom = vertices[0].position.y;
+    std::size_t i = 1;
+
+#if defined(SFML_SIMD_SSE2)
+
+    // Two positions per register: (x0, y0, x1, y1)
+    __m128 minimum = _mm_setr_ps(left, top, left, top);
+    __m128 maximum = minimum;
+
+    for (; i + 2 <= count; i += 2)
+    {
+        const __m64* first  = reinterpret_cast<const __m64*>(&vertices[i].position);
+        const __m64* second = reinterpret_cast<const __m64*>(&vertices[i + 1].position);
+
+        __m128 p = _mm_loadh_pi(_mm_loadl_pi(minimum, first), second);
+        minimum = _mm_min_ps(minimum, p);
+        maximum = _mm_max_ps(maximum, p);
+    }
+
+    // Merge the two halves of the registers
+    minimum = _mm_min_ps(minimum, _mm_movehl_ps(minimum, minimum));
+    maximum = _mm_max_ps(maximum, _mm_movehl_ps(maximum, maximum));
+
+    float values[4];
+    _mm_storeu_ps(values, _mm_movelh_ps(minimum, maximum));
+    left   = values[0];
+    top    = values[1];
+    right  = values[2];
+    bottom = values[3];
+
+#elif defined(SFML_SIMD_NEON)
+
+    const float start[2] = {left, top};
+    float32x2_t minimum = vld1_f32(start);
+    float32x2_t maximum = minimum;
+
+    for (; i < count; ++i)
+    {
+        float32x2_t p = vld1_f32(&vertices[i].position.x);
+        minimum = vmin_f32(minimum, p);
+        maximum = vmax_f32(maximum, p);
+    }
+
+    left   = vget_lane_f32(minimum, 0);
+    top    = vget_lane_f32(minimum, 1);
+    right  = vget_lane_f32(maximum, 0);
+    bottom = vget_lane_f32(maximum, 1);
+
+#endif
+
+    // Remaining vertices (or all of them if no vector instructions are available)
+    for (; i < count; ++i)
+    {
+        Vector2f position = vertices[i].position;
+
+        // Update left and right
+        if (position.x < left)
+            left = position.x;
+        else if (position.x > right)
+            right = position.x;
+
+        // Update top and bottom
+        if (position.y < top)
+            top = position.y;
+        else if (position.y > bottom)
+            bottom = position.y;
+    }
+
+    return FloatRect(left, top, right - left, bottom - top);
+}
+
+
 ////////////////////////////////////////////////////////////
 void VertexArray::draw(RenderTarget& target, RenderStates states) const
 {
@@ -147,4 +207,12 @@ void VertexArray::draw(RenderTarget& target, RenderStates states) const
         target.draw(&m_vertices[0], m_vertices.size(), m_primitiveType, states);
 }
 
+
+////////////////////////////////////////////////////////////
+bool VertexArray::getCullingBounds(FloatRect& bounds) const
+{
+    bounds = getBounds();
+    return true;
+}
+
 } // namespace sf
@@ -22,6 +22,15 @@
 //
 ////////////////////////////////////////////////////////////
 
+////////////////////////////////////////////////////////////
+// Use 64-bit file positions on 32-bit POSIX systems, so that
+// files larger than 2 GB can be transferred and resumed; this
+// must be defined before any standard header is included
+////////////////////////////////////////////////////////////
+#if !defined(_WIN32) && !defined(__ANDROID__) && !defined(_FILE_OFFSET_BITS)
+    #define _FILE_OFFSET_BITS 64
+#endif
+
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
@@ -30,10 +39,44 @@
 #include <SFML/System/Err.hpp>
 #include <algorithm>
 #include <cctype>
-#include <fstream>
 #include <iterator>
 #include <sstream>
 #include <cstdio>
+#ifndef SFML_SYSTEM_WINDOWS
+    #include <sys/types.h>
+#endif
+
+
+namespace
+{
+    // Default size of the buffer used for file transfers
+    const std::size_t defaultTransferBufferSize = 64 * 1024;
+
+    // Get the size of a file, using 64-bit positions since
+    // std::ftell returns a long, which may only have 32 bits
+    sf::Uint64 getFileSize(std::FILE* file)
+    {
+    #ifdef SFML_SYSTEM_WINDOWS
+
+        if (_fseeki64(file, 0, SEEK_END) != 0)
+            return 0;
+
+        __int64 size = _ftelli64(file);
+        _fseeki64(file, 0, SEEK_SET);
+
+    #else
+
+        if (fseeko(file, 0, SEEK_END) != 0)
+            return 0;
+
+        off_t size = ftello(file);
+        fseeko(file, 0, SEEK_SET);
+
+    #endif
+
+        return (size > 0) ? static_cast<sf::Uint64>(size) : 0;
+    }
+}
 
 
 namespace sf
@@ -50,18 +93,22 @@ public:
     Ftp::Response open(Ftp::TransferMode mode);
 
     ////////////////////////////////////////////////////////////
-    void send(std::istream& stream);
+    void send(std::FILE* file, Uint64 total, Ftp::TransferListener* listener);
 
     ////////////////////////////////////////////////////////////
     void receive(std::ostream& stream);
 
+    ////////////////////////////////////////////////////////////
+    void receive(std::FILE* file, Uint64 offset, Uint64 total, Ftp::TransferListener* listener);
+
 private:
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Ftp&      m_ftp;        ///< Reference to the owner Ftp instance
-    TcpSocket m_dataSocket; ///< Socket used for data transfers
+    Ftp&              m_ftp;        ///< Reference to the owner Ftp instance
+    TcpSocket         m_dataSocket; ///< Socket used for data transfers
+    std::vector<char> m_buffer;     ///< Buffer used for data transfers
 };
 
 
@@ -140,6 +187,14 @@ const std::vector<std::string>& Ftp::ListingResponse::getListing() const
 }
 
 
+////////////////////////////////////////////////////////////
+Ftp::Ftp() :
+m_transferBufferSize(defaultTransferBufferSize)
+{
+
+}
+
+
 ////////////////////////////////////////////////////////////
 Ftp::~Ftp()
 {
@@ -277,43 +332,90 @@ Ftp::Response Ftp::deleteFile(const std::string& name)
 ////////////////////////////////////////////////////////////
 Ftp::Response Ftp::download(const std::string& remoteFile, const std::string& localPath, TransferMode mode)
 {
+    return download(remoteFile, localPath, mode, false, NULL);
+}
+
+
+////////////////////////////////////////////////////////////
+Ftp::Response Ftp::download(const std::string& remoteFile, const std::string& localPath, TransferMode mode, bool resume, TransferListener* listener)
+{
+    // Extract the filename from the file path
+    std::string filename = remoteFile;
+    std::string::size_type pos = filename.find_last_of("/\\");
+    if (pos != std::string::npos)
+        filename = filename.substr(pos + 1);
+
+    // Make sure the destination path ends with a slash
+    std::string path = localPath;
+    if (!path.empty() && (path[path.size() - 1] != '\\') && (path[path.size() - 1] != '/'))
+        path += "/";
+
+    std::string filePath = path + filename;
+
+    // When resuming, find how much of the file we already have
+    Uint64 offset = 0;
+    if (resume)
+    {
+        std::FILE* existing = std::fopen(filePath.c_str(), "rb");
+        if (existing)
+        {
+            offset = getFileSize(existing);
+            std::fclose(existing);
+        }
+    }
+
     // Open a data channel using the given transfer mode
     DataChannel data(*this);
     Response response = data.open(mode);
     if (response.isOk())
     {
+        // Get the size of the file, so that we can report the progress
+        Uint64 total = 0;
+        if (listener)
+        {
+            Response sizeResponse = sendCommand("SIZE", remoteFile);
+            if (sizeResponse.getStatus() == Response::FileStatus)
+            {
+                std::istringstream in(sizeResponse.getMessage());
+                in >> total;
+            }
+        }
+
+        // Ask the server to skip the part of the file that we already have;
+        // if it can't, we have to download the whole file again
+        if (offset > 0)
+        {
+            std::ostringstream out;
+            out << offset;
+            if (sendCommand("REST", out.str()).getStatus() != Response::NeedInformation)
+                offset = 0;
+        }
+
         // Tell the server to start the transfer
         response = sendCommand("RETR", remoteFile);
         if (response.isOk())
         {
-            // Extract the filename from the file path
-            std::string filename = remoteFile;
-            std::string::size_type pos = filename.find_last_of("/\\");
-            if (pos != std::string::npos)
-                filename = filename.substr(pos + 1);
-
-            // Make sure the destination path ends with a slash
-            std::string path = localPath;
-            if (!path.empty() && (path[path.size() - 1] != '\\') && (path[path.size() - 1] != '/'))
-                path += "/";
-
-            // Create the file and truncate it if necessary
-            std::ofstream file((path + filename).c_str(), std::ios_base::binary | std::ios_base::trunc);
+            // Create the file (or append to it when resuming), and truncate it if necessary
+            std::FILE* file = std::fopen(filePath.c_str(), (offset > 0) ? "ab" : "wb");
             if (!file)
                 return Response(Response::InvalidFile);
 
+            // Our own buffer is large enough, don't add another level of buffering
+            std::setvbuf(file, NULL, _IONBF, 0);
+
             // Receive the file data
-            data.receive(file);
+            data.receive(file, offset, total, listener);
 
             // Close the file
-            file.close();
+            std::fclose(file);
 
             // Get the response from the server
             response = getResponse();
 
             // If the download was unsuccessful, delete the partial file
-            if (!response.isOk())
-                std::remove((path + filename).c_str());
+            // (unless we're resuming, in which case it will be resumed later)
+            if (!response.isOk() && !resume)
+                std::remove(filePath.c_str());
         }
     }
 
@@ -324,11 +426,26 @@ Ftp::Response Ftp::download(const std::string& remoteFile, const std::string& lo
 ////////////////////////////////////////////////////////////
 Ftp::Response Ftp::upload(const std::string& localFile, const std::string& remotePath, TransferMode mode, bool append)
 {
-    // Get the contents of the file to send
-    std::ifstream file(localFile.c_str(), std::ios_base::binary);
+    return upload(localFile, remotePath, mode, append, NULL);
+}
+
+
+////////////////////////////////////////////////////////////
+Ftp::Response Ftp::upload(const std::string& localFile, const std::string& remotePath, TransferMode mode, bool append, TransferListener* listener)
+{
+    // Open the file to send
+    std::FILE* file = std::fopen(localFile.c_str(), "rb");
     if (!file)
         return Response(Response::InvalidFile);
 
+    // Our own buffer is large enough, don't add another level of buffering
+    std::setvbuf(file, NULL, _IONBF, 0);
+
+    // Get the size of the file, so that we can report the progress
+    Uint64 total = 0;
+    if (listener)
+        total = getFileSize(file);
+
     // Extract the filename from the file path
     std::string filename = localFile;
     std::string::size_type pos = filename.find_last_of("/\\");
@@ -350,17 +467,34 @@ Ftp::Response Ftp::upload(const std::string& localFile, const std::string& remot
         if (response.isOk())
         {
             // Send the file data
-            data.send(file);
+            data.send(file, total, listener);
 
             // Get the response from the server
             response = getResponse();
         }
     }
 
+    // Close the file
+    std::fclose(file);
+
     return response;
 }
 
 
+////////////////////////////////////////////////////////////
+void Ftp::setTransferBufferSize(std::size_t size)
+{
+    m_transferBufferSize = size;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Ftp::getTransferBufferSize() const
+{
+    return m_transferBufferSize;
+}
+
+
 ////////////////////////////////////////////////////////////
 Ftp::Response Ftp::sendCommand(const std::string& command, const std::string& parameter)
 {
@@ -524,7 +658,8 @@ Ftp::Response Ftp::getResponse()
 
 ////////////////////////////////////////////////////////////
 Ftp::DataChannel::DataChannel(Ftp& owner) :
-m_ftp(owner)
+m_ftp   (owner),
+m_buffer(std::max<std::size_t>(owner.m_transferBufferSize, 1))
 {
 
 }
@@ -595,11 +730,10 @@ Ftp::Response Ftp::DataChannel::open(Ftp::TransferMode mode)
 void Ftp::DataChannel::receive(std::ostream& stream)
 {
     // Receive data
-    char buffer[1024];
     std::size_t received;
-    while (m_dataSocket.receive(buffer, sizeof(buffer), received) == Socket::Done)
+    while (m_dataSocket.receive(&m_buffer[0], m_buffer.size(), received) == Socket::Done)
     {
-        stream.write(buffer, static_cast<std::streamsize>(received));
+        stream.write(&m_buffer[0], static_cast<std::streamsize>(received));
 
         if (!stream.good())
         {
@@ -614,29 +748,55 @@ void Ftp::DataChannel::receive(std::ostream& stream)
 
 
 ////////////////////////////////////////////////////////////
-void Ftp::DataChannel::send(std::istream& stream)
+void Ftp::DataChannel::receive(std::FILE* file, Uint64 offset, Uint64 total, Ftp::TransferListener* listener)
 {
-    // Send data
-    char buffer[1024];
-    std::size_t count;
+    // Receive data
+    Uint64 transferred = offset;
+    std::size_t received;
+    while (m_dataSocket.receive(&m_buffer[0], m_buffer.size(), received) == Socket::Done)
+    {
+        if (std::fwrite(&m_buffer[0], 1, received, file) != received)
+        {
+            err() << "FTP Error: Writing to the file has failed" << std::endl;
+            break;
+        }
+
+        // Report the progress, and abort if requested
+        transferred += received;
+        if (listener && !listener->onProgress(transferred, total))
+            break;
+    }
 
+    // Close the data socket
+    m_dataSocket.disconnect();
+}
+
+
+////////////////////////////////////////////////////////////
+void Ftp::DataChannel::send(std::FILE* file, Uint64 total, Ftp::TransferListener* listener)
+{
+    // Send data
+    Uint64 transferred = 0;
     for (;;)
     {
-        // read some data from the stream
-        stream.read(buffer, sizeof(buffer));
+        // read some data from the file
+        std::size_t count = std::fread(&m_buffer[0], 1, m_buffer.size(), file);
 
-        if (!stream.good() && !stream.eof())
+        if (std::ferror(file))
         {
             err() << "FTP Error: Reading from the file has failed" << std::endl;
             break;
         }
 
-        count = static_cast<std::size_t>(stream.gcount());
-
         if (count > 0)
         {
-            // we could read more data from the stream: send them
-            if (m_dataSocket.send(buffer, count) != Socket::Done)
+            // we could read more data from the file: send them
+            if (m_dataSocket.send(&m_buffer[0], count) != Socket::Done)
+                break;
+
+            // Report the progress, and abort if requested
+            transferred += count;
+            if (listener && !listener->onProgress(transferred, total))
                 break;
         }
         else
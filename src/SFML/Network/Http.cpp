@@ -32,6 +32,7 @@
 #include <iterator>
 #include <sstream>
 #include <limits>
+#include <vector>
 
 
 namespace
@@ -43,6 +44,188 @@ namespace
             *i = static_cast<char>(std::tolower(*i));
         return str;
     }
+
+    // Size of the buffer used to receive responses
+    const std::size_t receiveBufferSize = 65536;
+
+    // Find the end of the header (the empty line) in a response,
+    // starting the search at the given position
+    std::string::size_type findHeaderEnd(const std::string& data, std::string::size_type start)
+    {
+        std::string::size_type crlf = data.find("\n\r\n", start);
+        std::string::size_type lf   = data.find("\n\n", start);
+
+        if ((crlf != std::string::npos) && ((lf == std::string::npos) || (crlf < lf)))
+            return crlf + 3;
+        else if (lf != std::string::npos)
+            return lf + 2;
+        else
+            return std::string::npos;
+    }
+
+    // Handler that accumulates the body of a response into a string
+    class StringBodyHandler : public sf::Http::ResponseHandler
+    {
+    public:
+
+        StringBodyHandler(std::string& body) :
+        m_body(body)
+        {
+        }
+
+        virtual bool onHeader(const sf::Http::Response& response)
+        {
+            // Avoid successive reallocations when the size of the body is known
+            std::istringstream in(response.getField("content-length"));
+            std::size_t length = 0;
+            if (in >> length)
+                m_body.reserve(std::min<std::size_t>(length, 64 * 1024 * 1024));
+
+            return true;
+        }
+
+        virtual bool onBody(const char* data, std::size_t size)
+        {
+            m_body.append(data, size);
+            return true;
+        }
+
+    private:
+
+        std::string& m_body;
+    };
+
+    // Decode the body of a response as it is received,
+    // and forward its content to a response handler
+    class BodyDecoder
+    {
+    public:
+
+        enum Framing
+        {
+            NoBody,        // The response has no body
+            ContentLength, // The body size is given by the Content-Length field
+            Chunked,       // The body uses chunked transfer encoding
+            UntilClose     // The body ends when the server closes the connection
+        };
+
+        BodyDecoder(Framing framing, sf::Uint64 length) :
+        m_state    (Data),
+        m_framing  (framing),
+        m_remaining(length)
+        {
+            if ((framing == NoBody) || ((framing == ContentLength) && (length == 0)))
+                m_state = Finished;
+            else if (framing == Chunked)
+                m_state = ChunkSize;
+        }
+
+        // Process received data; return the number of bytes that were consumed
+        std::size_t feed(const char* data, std::size_t size, sf::Http::ResponseHandler& handler)
+        {
+            std::size_t pos = 0;
+            while ((pos < size) && !isFinished())
+            {
+                if (m_state == Data)
+                {
+                    // Forward as much content as possible at once
+                    std::size_t count = size - pos;
+                    if ((m_framing != UntilClose) && (count > m_remaining))
+                        count = static_cast<std::size_t>(m_remaining);
+
+                    bool accepted = handler.onBody(data + pos, count);
+                    pos += count;
+
+                    if (m_framing != UntilClose)
+                    {
+                        m_remaining -= count;
+                        if (m_remaining == 0)
+                            m_state = (m_framing == Chunked) ? ChunkEnd : Finished;
+                    }
+
+                    if (!accepted)
+                        m_state = Aborted;
+                }
+                else
+                {
+                    // Chunk sizes, chunk terminators and trailers are read line by line
+                    char character = data[pos++];
+                    if (character != '\n')
+                    {
+                        m_line += character;
+                        continue;
+                    }
+
+                    // Remove any trailing \r
+                    if (!m_line.empty() && (*m_line.rbegin() == '\r'))
+                        m_line.erase(m_line.size() - 1);
+
+                    if (m_state == ChunkSize)
+                    {
+                        // The chunk size may be followed by a chunk-extension, which is ignored
+                        std::istringstream in(m_line);
+                        if (in >> std::hex >> m_remaining)
+                            m_state = (m_remaining > 0) ? Data : Trailers;
+                        else
+                            m_state = Aborted;
+                    }
+                    else if (m_state == ChunkEnd)
+                    {
+                        m_state = ChunkSize;
+                    }
+                    else if (m_line.empty())
+                    {
+                        // Empty line: end of the trailers
+                        m_state = Finished;
+                    }
+                    else
+                    {
+                        m_trailers += m_line + "\r\n";
+                    }
+
+                    m_line.clear();
+                }
+            }
+
+            return pos;
+        }
+
+        // Check whether the whole body was received, or the transfer aborted
+        bool isFinished() const
+        {
+            return (m_state == Finished) || (m_state == Aborted);
+        }
+
+        // Check whether the whole body was received
+        bool isComplete() const
+        {
+            return m_state == Finished;
+        }
+
+        // Get the trailer fields that followed a chunked body
+        const std::string& getTrailers() const
+        {
+            return m_trailers;
+        }
+
+    private:
+
+        enum State
+        {
+            Data,      // Receiving content
+            ChunkSize, // Receiving the size line of a chunk
+            ChunkEnd,  // Receiving the line terminating a chunk
+            Trailers,  // Receiving the trailer fields of a chunked body
+            Finished,  // Done
+            Aborted    // Aborted by the handler, or invalid data
+        };
+
+        State       m_state;     // Current decoding state
+        Framing     m_framing;   // How the end of the body is determined
+        sf::Uint64  m_remaining; // Number of bytes left in the body or current chunk
+        std::string m_line;      // Line being received
+        std::string m_trailers;  // Trailer fields received after a chunked body
+    };
 }
 
 
@@ -297,8 +480,16 @@ void Http::Response::parseFields(std::istream &in)
 }
 
 
+////////////////////////////////////////////////////////////
+bool Http::ResponseHandler::onHeader(const Response&)
+{
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 Http::Http() :
+m_connected(false),
 m_host(),
 m_port(0)
 {
@@ -307,7 +498,8 @@ m_port(0)
 
 
 ////////////////////////////////////////////////////////////
-Http::Http(const std::string& host, unsigned short port)
+Http::Http(const std::string& host, unsigned short port) :
+m_connected(false)
 {
     setHost(host, port);
 }
@@ -316,6 +508,9 @@ Http::Http(const std::string& host, unsigned short port)
 ////////////////////////////////////////////////////////////
 void Http::setHost(const std::string& host, unsigned short port)
 {
+    // A connection kept alive with the previous host can't be reused
+    disconnect();
+
     // Check the protocol
     if (toLower(host.substr(0, 7)) == "http://")
     {
@@ -348,68 +543,276 @@ void Http::setHost(const std::string& host, unsigned short port)
 ////////////////////////////////////////////////////////////
 Http::Response Http::sendRequest(const Http::Request& request, Time timeout)
 {
-    // First make sure that the request is valid -- add missing mandatory fields
-    Request toSend(request);
-    if (!toSend.hasField("From"))
+    std::vector<Request> requests(1, request);
+    std::vector<Response> responses(1);
+    exchange(requests, responses, NULL, timeout);
+
+    return responses[0];
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Response Http::sendRequest(const Http::Request& request, ResponseHandler& handler, Time timeout)
+{
+    std::vector<Request> requests(1, request);
+    std::vector<Response> responses(1);
+    exchange(requests, responses, &handler, timeout);
+
+    return responses[0];
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Http::Response> Http::sendRequests(const std::vector<Request>& requests, Time timeout)
+{
+    std::vector<Response> responses(requests.size());
+    exchange(requests, responses, NULL, timeout);
+
+    return responses;
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::exchange(const std::vector<Request>& requests, std::vector<Response>& responses, ResponseHandler* handler, Time timeout)
+{
+    // Prepare all the requests once, they may have to be sent more than once
+    std::vector<std::string> prepared(requests.size());
+    std::vector<bool> keepAlive(requests.size());
+    std::vector<bool> canRetry(requests.size());
+    for (std::size_t i = 0; i < requests.size(); ++i)
     {
-        toSend.setField("From", "user@sfml-dev.org");
+        Request toSend(requests[i]);
+        keepAlive[i] = completeRequest(toSend);
+        prepared[i] = toSend.prepare();
+
+        // Only GET and HEAD requests are safe to send again if the connection
+        // is lost, since the server may already have processed them (RFC 7230 6.3.1)
+        canRetry[i] = (requests[i].m_method == Request::Get) || (requests[i].m_method == Request::Head);
+    }
+
+    std::size_t done = 0;
+    while (done < requests.size())
+    {
+        // A connection kept alive from a previous request may have
+        // been closed by the server since then; in this case we'll
+        // try again with a new connection if the requests allow it
+        bool reused = m_connected;
+
+        // Connect the socket to the host
+        if (!m_connected)
+        {
+            if (m_connection.connect(m_host, m_port, timeout) != Socket::Done)
+                return;
+
+            m_connected = true;
+        }
+
+        // A new connection only gets the next request, since the server
+        // may close it after the first response. Once it has confirmed
+        // that it keeps the connection alive, the remaining requests are
+        // pipelined up to the first one that asks to close it; nothing is
+        // pipelined after a request that can't be retried (RFC 7230 6.3.2)
+        std::size_t end = done + 1;
+        if (reused)
+        {
+            while ((end < requests.size()) && keepAlive[end - 1] && canRetry[end - 1])
+                ++end;
+        }
+
+        std::string requestStr;
+        for (std::size_t i = done; i < end; ++i)
+            requestStr += prepared[i];
+
+        // Send the requests through the socket, and wait for the server's responses
+        std::size_t received = done;
+        bool canReuse = false;
+        if (m_connection.send(requestStr.c_str(), requestStr.size()) == Socket::Done)
+        {
+            while (received < end)
+            {
+                Response& response = responses[received];
+                bool hasBody = requests[received].m_method != Request::Head;
+
+                if (handler)
+                {
+                    canReuse = receiveResponse(response, *handler, hasBody);
+                }
+                else
+                {
+                    std::string body;
+                    StringBodyHandler stringHandler(body);
+                    canReuse = receiveResponse(response, stringHandler, hasBody);
+                    response.m_body.swap(body);
+                }
+
+                // Stop if the connection was closed before receiving anything
+                if (response.getStatus() == Response::ConnectionFailed)
+                    break;
+
+                canReuse = canReuse && keepAlive[received];
+                ++received;
+
+                if (!canReuse)
+                    break;
+            }
+        }
+
+        // Close the connection unless the server allows us to reuse it
+        if (!canReuse || (received < end))
+            disconnect();
+
+        // Give up if a new connection didn't give any response
+        if ((received == done) && !reused)
+            return;
+
+        // The requests that were sent but not answered may have been processed
+        // by the server: only send them again if it's safe, otherwise leave
+        // their responses with the ConnectionFailed status
+        for (std::size_t i = received; i < end; ++i)
+        {
+            if (!canRetry[i])
+                return;
+        }
+
+        done = received;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Http::completeRequest(Request& request) const
+{
+    if (!request.hasField("From"))
+    {
+        request.setField("From", "user@sfml-dev.org");
     }
-    if (!toSend.hasField("User-Agent"))
+    if (!request.hasField("User-Agent"))
     {
-        toSend.setField("User-Agent", "libsfml-network/2.x");
+        request.setField("User-Agent", "libsfml-network/2.x");
     }
-    if (!toSend.hasField("Host"))
+    if (!request.hasField("Host"))
     {
-        toSend.setField("Host", m_hostName);
+        request.setField("Host", m_hostName);
     }
-    if (!toSend.hasField("Content-Length"))
+    if (!request.hasField("Content-Length"))
     {
         std::ostringstream out;
-        out << toSend.m_body.size();
-        toSend.setField("Content-Length", out.str());
+        out << request.m_body.size();
+        request.setField("Content-Length", out.str());
     }
-    if ((toSend.m_method == Request::Post) && !toSend.hasField("Content-Type"))
+    if ((request.m_method == Request::Post) && !request.hasField("Content-Type"))
     {
-        toSend.setField("Content-Type", "application/x-www-form-urlencoded");
+        request.setField("Content-Type", "application/x-www-form-urlencoded");
     }
-    if ((toSend.m_majorVersion * 10 + toSend.m_minorVersion >= 11) && !toSend.hasField("Connection"))
+    if ((request.m_majorVersion * 10 + request.m_minorVersion >= 11) && !request.hasField("Connection"))
     {
-        toSend.setField("Connection", "close");
+        request.setField("Connection", "close");
     }
 
-    // Prepare the response
-    Response received;
+    Request::FieldTable::const_iterator connection = request.m_fields.find("connection");
+    return (connection != request.m_fields.end()) && (toLower(connection->second) == "keep-alive");
+}
 
-    // Connect the socket to the host
-    if (m_connection.connect(m_host, m_port, timeout) == Socket::Done)
-    {
-        // Convert the request to string and send it through the connected socket
-        std::string requestStr = toSend.prepare();
+////////////////////////////////////////////////////////////
+bool Http::receiveResponse(Response& response, ResponseHandler& handler, bool hasBody)
+{
+    std::vector<char> buffer(receiveBufferSize);
+    std::size_t size = 0;
 
-        if (!requestStr.empty())
+    // Start with the data that was received after the previous response, if any
+    std::string header;
+    header.swap(m_pending);
+
+    // Receive data until the whole header is available
+    std::string::size_type headerEnd = findHeaderEnd(header, 0);
+    while (headerEnd == std::string::npos)
+    {
+        if (m_connection.receive(&buffer[0], buffer.size(), size) != Socket::Done)
         {
-            // Send it through the socket
-            if (m_connection.send(requestStr.c_str(), requestStr.size()) == Socket::Done)
+            // The connection was closed before the end of the header:
+            // parse what we got, and forward any body it may contain
+            if (!header.empty())
             {
-                // Wait for the server's response
-                std::string receivedStr;
-                std::size_t size = 0;
-                char buffer[1024];
-                while (m_connection.receive(buffer, sizeof(buffer), size) == Socket::Done)
-                {
-                    receivedStr.append(buffer, buffer + size);
-                }
-
-                // Build the Response object from the received data
-                received.parse(receivedStr);
+                response.parse(header);
+                if ((response.getStatus() != Response::InvalidResponse) && handler.onHeader(response) && !response.m_body.empty())
+                    handler.onBody(response.m_body.data(), response.m_body.size());
+                response.m_body.clear();
             }
+            return false;
         }
 
-        // Close the connection
-        m_connection.disconnect();
+        std::string::size_type searchStart = header.size() > 2 ? header.size() - 2 : 0;
+        header.append(&buffer[0], size);
+        headerEnd = findHeaderEnd(header, searchStart);
+    }
+
+    // Extract the beginning of the body, and build the Response object from the header
+    std::string bodyStart = header.substr(headerEnd);
+    header.erase(headerEnd);
+    response.parse(header);
+
+    if ((response.getStatus() == Response::InvalidResponse) || !handler.onHeader(response))
+        return false;
+
+    // Determine how the end of the body will be detected
+    int status = response.getStatus();
+    BodyDecoder::Framing framing = BodyDecoder::UntilClose;
+    Uint64 length = 0;
+    if (!hasBody || ((status >= 100) && (status < 200)) || (status == Response::NoContent) || (status == Response::NotModified))
+    {
+        framing = BodyDecoder::NoBody;
+    }
+    else if (toLower(response.getField("transfer-encoding")) == "chunked")
+    {
+        framing = BodyDecoder::Chunked;
+    }
+    else
+    {
+        std::istringstream in(response.getField("content-length"));
+        if (in >> length)
+            framing = BodyDecoder::ContentLength;
+    }
+
+    // Receive the body and forward it to the handler; anything
+    // received after its end belongs to the next response
+    BodyDecoder decoder(framing, length);
+    std::size_t consumed = decoder.feed(bodyStart.data(), bodyStart.size(), handler);
+    if (consumed < bodyStart.size())
+        m_pending.assign(bodyStart, consumed, std::string::npos);
+
+    while (!decoder.isFinished() && (m_connection.receive(&buffer[0], buffer.size(), size) == Socket::Done))
+    {
+        consumed = decoder.feed(&buffer[0], size, handler);
+        if (consumed < size)
+            m_pending.assign(&buffer[consumed], size - consumed);
+    }
+
+    // Read all trailers (if present)
+    if (!decoder.getTrailers().empty())
+    {
+        std::istringstream in(decoder.getTrailers());
+        response.parseFields(in);
     }
 
-    return received;
+    // The connection can only be reused if the server didn't ask to close
+    // it, and if the end of the body was found without closing it
+    if (!decoder.isComplete() || (framing == BodyDecoder::UntilClose))
+        return false;
+
+    std::string connection = toLower(response.getField("connection"));
+    if (response.getMajorHttpVersion() * 10 + response.getMinorHttpVersion() >= 11)
+        return connection != "close";
+    else
+        return connection == "keep-alive";
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::disconnect()
+{
+    m_connection.disconnect();
+    m_connected = false;
+    m_pending.clear();
 }
 
 } // namespace sf
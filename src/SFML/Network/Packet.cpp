@@ -28,6 +28,8 @@
 #include <SFML/Network/Packet.hpp>
 #include <SFML/Network/SocketImpl.hpp>
 #include <SFML/System/String.hpp>
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <cwchar>
 
@@ -38,7 +40,9 @@ namespace sf
 Packet::Packet() :
 m_readPos(0),
 m_sendPos(0),
-m_isValid(true)
+m_isValid(true),
+m_readBitPos(0),
+m_writeBitPos(0)
 {
 
 }
@@ -59,6 +63,9 @@ void Packet::append(const void* data, std::size_t sizeInBytes)
         std::size_t start = m_data.size();
         m_data.resize(start + sizeInBytes);
         std::memcpy(&m_data[start], data, sizeInBytes);
+
+        // Bits written after this will start a new byte
+        m_writeBitPos = 0;
     }
 }
 
@@ -69,6 +76,8 @@ void Packet::clear()
     m_data.clear();
     m_readPos = 0;
     m_isValid = true;
+    m_readBitPos = 0;
+    m_writeBitPos = 0;
 }
 
 
@@ -570,10 +579,245 @@ Packet& Packet::operator <<(const String& data)
 }
 
 
+////////////////////////////////////////////////////////////
+Packet& Packet::writeVarUint(Uint64 data)
+{
+    // 7 bits per byte, least significant group first; the high
+    // bit of each byte tells whether more bytes follow
+    Uint8 toWrite[10];
+    std::size_t size = 0;
+    while (data >= 0x80)
+    {
+        toWrite[size++] = static_cast<Uint8>((data & 0x7F) | 0x80);
+        data >>= 7;
+    }
+    toWrite[size++] = static_cast<Uint8>(data);
+
+    append(toWrite, size);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeVarInt(Int64 data)
+{
+    // Zig-zag encoding: 0, -1, 1, -2, 2... become 0, 1, 2, 3, 4...
+    Uint64 value = static_cast<Uint64>(data) << 1;
+    if (data < 0)
+        value = ~value;
+
+    return writeVarUint(value);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeVarString(const std::string& data)
+{
+    // First insert string length
+    writeVarUint(data.size());
+
+    // Then insert characters
+    if (!data.empty())
+        append(data.c_str(), data.size() * sizeof(std::string::value_type));
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeBits(Uint32 data, unsigned int bitCount)
+{
+    bitCount = std::min(bitCount, 32u);
+
+    while (bitCount > 0)
+    {
+        // Start a new byte if the last one is full (or was not written bit by bit)
+        if (m_writeBitPos == 0)
+            m_data.push_back(0);
+
+        unsigned int count = std::min(8 - m_writeBitPos, bitCount);
+        Uint8 bits = static_cast<Uint8>(data & ((1u << count) - 1));
+        m_data.back() = static_cast<char>(static_cast<Uint8>(m_data.back()) | (bits << m_writeBitPos));
+
+        data = (count < 32) ? (data >> count) : 0;
+        bitCount -= count;
+        m_writeBitPos = (m_writeBitPos + count) % 8;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeBool(bool data)
+{
+    return writeBits(data ? 1 : 0, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeQuantizedFloat(float data, float min, float max, unsigned int bitCount)
+{
+    bitCount = std::max(std::min(bitCount, 32u), 1u);
+
+    double steps = static_cast<double>((static_cast<Uint64>(1) << bitCount) - 1);
+    double range = static_cast<double>(max) - static_cast<double>(min);
+    double ratio = (range > 0) ? (static_cast<double>(data) - min) / range : 0.0;
+    ratio = std::max(0.0, std::min(ratio, 1.0));
+
+    return writeBits(static_cast<Uint32>(std::floor(ratio * steps + 0.5)), bitCount);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readVarUint(Uint64& data)
+{
+    Uint64 value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        Uint8 byte = 0;
+        if (!(*this >> byte))
+            return *this;
+
+        // The 10th byte can only carry the 64th bit
+        if ((shift == 63) && ((byte & 0x7E) != 0))
+        {
+            m_isValid = false;
+            return *this;
+        }
+
+        value |= static_cast<Uint64>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            data = value;
+            return *this;
+        }
+    }
+
+    // More than 10 bytes: the data is corrupted
+    m_isValid = false;
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readVarInt(Int64& data)
+{
+    Uint64 value = 0;
+    if (readVarUint(value))
+        data = static_cast<Int64>((value >> 1) ^ (0 - (value & 1)));
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readVarString(std::string& data)
+{
+    // First extract string length
+    Uint64 length = 0;
+    readVarUint(length);
+
+    // Reject lengths larger than the remaining data before narrowing them to
+    // std::size_t, which would truncate them on 32-bit platforms
+    if (length > m_data.size() - m_readPos)
+        m_isValid = false;
+
+    data.clear();
+    if ((length > 0) && checkSize(static_cast<std::size_t>(length)))
+    {
+        // Then extract characters
+        data.assign(&m_data[m_readPos], static_cast<std::size_t>(length));
+
+        // Update reading position
+        m_readPos += static_cast<std::size_t>(length);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readBits(Uint32& data, unsigned int bitCount)
+{
+    bitCount = std::min(bitCount, 32u);
+
+    if (checkBits(bitCount))
+    {
+        Uint32 value = 0;
+        unsigned int shift = 0;
+        while (shift < bitCount)
+        {
+            unsigned int count = std::min(8 - m_readBitPos, bitCount - shift);
+            Uint32 byte = static_cast<Uint8>(m_data[m_readPos]);
+            value |= ((byte >> m_readBitPos) & ((1u << count) - 1)) << shift;
+
+            shift += count;
+            m_readBitPos += count;
+            if (m_readBitPos == 8)
+            {
+                m_readBitPos = 0;
+                ++m_readPos;
+            }
+        }
+
+        data = value;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readBool(bool& data)
+{
+    Uint32 value = 0;
+    if (readBits(value, 1))
+        data = (value != 0);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readQuantizedFloat(float& data, float min, float max, unsigned int bitCount)
+{
+    bitCount = std::max(std::min(bitCount, 32u), 1u);
+
+    Uint32 value = 0;
+    if (readBits(value, bitCount))
+    {
+        double steps = static_cast<double>((static_cast<Uint64>(1) << bitCount) - 1);
+        double range = static_cast<double>(max) - static_cast<double>(min);
+        data = static_cast<float>(min + value / steps * range);
+    }
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Packet::checkSize(std::size_t size)
 {
-    m_isValid = m_isValid && (m_readPos + size <= m_data.size());
+    // Byte-level reads always start at a byte boundary
+    if (m_readBitPos > 0)
+    {
+        m_readBitPos = 0;
+        ++m_readPos;
+    }
+
+    // Written so that a huge size can't overflow the computation
+    m_isValid = m_isValid && (size <= m_data.size() - m_readPos);
+
+    return m_isValid;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Packet::checkBits(std::size_t bitCount)
+{
+    std::size_t available = (m_readPos < m_data.size()) ? (m_data.size() - m_readPos) * 8 - m_readBitPos : 0;
+    m_isValid = m_isValid && (bitCount <= available);
 
     return m_isValid;
 }
@@ -42,10 +42,14 @@ namespace sf
 ////////////////////////////////////////////////////////////
 struct SocketSelector::SocketSelectorImpl
 {
-    fd_set allSockets;   ///< Set containing all the sockets handles
-    fd_set socketsReady; ///< Set containing handles of the sockets that are ready
-    int    maxSocket;    ///< Maximum socket handle
-    int    socketCount;  ///< Number of socket handles
+    fd_set allSockets;       ///< Set containing all the sockets handles
+    fd_set socketsReady;     ///< Set containing handles of the sockets that are ready
+    fd_set allSendSockets;   ///< Set containing the handles of the sockets observed for sending
+    fd_set sendSocketsReady; ///< Set containing handles of the sockets that are ready to send
+    fd_set sendSocketsError; ///< Set containing handles of the sockets whose connection failed (Windows)
+    int    maxSocket;        ///< Maximum socket handle
+    int    socketCount;      ///< Number of socket handles
+    int    sendSocketCount;  ///< Number of socket handles observed for sending
 };
 
 
@@ -115,7 +119,7 @@ void SocketSelector::add(Socket& socket)
 
 
 ////////////////////////////////////////////////////////////
-void SocketSelector::remove(Socket& socket)
+void SocketSelector::addForSending(Socket& socket)
 {
     SocketHandle handle = socket.getHandle();
     if (handle != priv::SocketImpl::invalidSocket())
@@ -123,10 +127,53 @@ void SocketSelector::remove(Socket& socket)
 
 #if defined(SFML_SYSTEM_WINDOWS)
 
-        if (!FD_ISSET(handle, &m_impl->allSockets))
+        if (m_impl->sendSocketCount >= FD_SETSIZE)
+        {
+            err() << "The socket can't be added to the selector because the "
+                  << "selector is full. This is a limitation of your operating "
+                  << "system's FD_SETSIZE setting.";
+            return;
+        }
+
+        if (FD_ISSET(handle, &m_impl->allSendSockets))
             return;
 
-        m_impl->socketCount--;
+        m_impl->sendSocketCount++;
+
+#else
+
+        if (handle >= FD_SETSIZE)
+        {
+            err() << "The socket can't be added to the selector because its "
+                  << "ID is too high. This is a limitation of your operating "
+                  << "system's FD_SETSIZE setting.";
+            return;
+        }
+
+        // SocketHandle is an int in POSIX
+        m_impl->maxSocket = std::max(m_impl->maxSocket, handle);
+
+#endif
+
+        FD_SET(handle, &m_impl->allSendSockets);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::remove(Socket& socket)
+{
+    SocketHandle handle = socket.getHandle();
+    if (handle != priv::SocketImpl::invalidSocket())
+    {
+
+#if defined(SFML_SYSTEM_WINDOWS)
+
+        if (FD_ISSET(handle, &m_impl->allSockets))
+            m_impl->socketCount--;
+
+        if (FD_ISSET(handle, &m_impl->allSendSockets))
+            m_impl->sendSocketCount--;
 
 #else
 
@@ -137,6 +184,9 @@ void SocketSelector::remove(Socket& socket)
 
         FD_CLR(handle, &m_impl->allSockets);
         FD_CLR(handle, &m_impl->socketsReady);
+        FD_CLR(handle, &m_impl->allSendSockets);
+        FD_CLR(handle, &m_impl->sendSocketsReady);
+        FD_CLR(handle, &m_impl->sendSocketsError);
     }
 }
 
@@ -146,9 +196,13 @@ void SocketSelector::clear()
 {
     FD_ZERO(&m_impl->allSockets);
     FD_ZERO(&m_impl->socketsReady);
+    FD_ZERO(&m_impl->allSendSockets);
+    FD_ZERO(&m_impl->sendSocketsReady);
+    FD_ZERO(&m_impl->sendSocketsError);
 
     m_impl->maxSocket = 0;
     m_impl->socketCount = 0;
+    m_impl->sendSocketCount = 0;
 }
 
 
@@ -160,12 +214,14 @@ bool SocketSelector::wait(Time timeout)
     time.tv_sec  = static_cast<long>(timeout.asMicroseconds() / 1000000);
     time.tv_usec = static_cast<long>(timeout.asMicroseconds() % 1000000);
 
-    // Initialize the set that will contain the sockets that are ready
-    m_impl->socketsReady = m_impl->allSockets;
+    // Initialize the sets that will contain the sockets that are ready
+    m_impl->socketsReady     = m_impl->allSockets;
+    m_impl->sendSocketsReady = m_impl->allSendSockets;
+    m_impl->sendSocketsError = m_impl->allSendSockets;
 
-    // Wait until one of the sockets is ready for reading, or timeout is reached
+    // Wait until one of the sockets is ready for reading (or sending), or timeout is reached
     // The first parameter is ignored on Windows
-    int count = select(m_impl->maxSocket + 1, &m_impl->socketsReady, NULL, NULL, timeout != Time::Zero ? &time : NULL);
+    int count = select(m_impl->maxSocket + 1, &m_impl->socketsReady, &m_impl->sendSocketsReady, &m_impl->sendSocketsError, timeout != Time::Zero ? &time : NULL);
 
     return count > 0;
 }
@@ -192,6 +248,28 @@ bool SocketSelector::isReady(Socket& socket) const
 }
 
 
+////////////////////////////////////////////////////////////
+bool SocketSelector::isReadyToSend(Socket& socket) const
+{
+    SocketHandle handle = socket.getHandle();
+    if (handle != priv::SocketImpl::invalidSocket())
+    {
+
+#if !defined(SFML_SYSTEM_WINDOWS)
+
+        if (handle >= FD_SETSIZE)
+            return false;
+
+#endif
+
+        // Windows reports failed connections in the error set rather than in the write set
+        return (FD_ISSET(handle, &m_impl->sendSocketsReady) != 0) || (FD_ISSET(handle, &m_impl->sendSocketsError) != 0);
+    }
+
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 SocketSelector& SocketSelector::operator =(const SocketSelector& right)
 {
@@ -167,18 +167,8 @@ Socket::Status TcpSocket::connect(const IpAddress& remoteAddress, unsigned short
         // Otherwise, wait until something happens to our socket (success, timeout or error)
         if (status == Socket::NotReady)
         {
-            // Setup the selector
-            fd_set selector;
-            FD_ZERO(&selector);
-            FD_SET(getHandle(), &selector);
-
-            // Setup the timeout
-            timeval time;
-            time.tv_sec  = static_cast<long>(timeout.asMicroseconds() / 1000000);
-            time.tv_usec = static_cast<long>(timeout.asMicroseconds() % 1000000);
-
             // Wait for something to write on our socket (which means that the connection request has returned)
-            if (select(static_cast<int>(getHandle() + 1), NULL, &selector, NULL, &time) > 0)
+            if (priv::SocketImpl::checkReady(getHandle(), true, timeout) > 0)
             {
                 // At this point the connection may have been either accepted or refused.
                 // To know whether it's a success or a failure, we must check the address of the connected peer
@@ -208,6 +198,29 @@ Socket::Status TcpSocket::connect(const IpAddress& remoteAddress, unsigned short
 }
 
 
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::finishConnect()
+{
+    if (getHandle() == priv::SocketImpl::invalidSocket())
+        return Disconnected;
+
+    // Check (without waiting) whether the connection request has returned
+    int count = priv::SocketImpl::checkReady(getHandle(), true);
+    if (count == 0)
+        return NotReady;
+    else if (count < 0)
+        return priv::SocketImpl::getErrorStatus();
+
+    // At this point the connection may have been either accepted or refused.
+    // To know whether it's a success or a failure, we must check the address of the connected peer
+    if (getRemoteAddress() != IpAddress::None)
+        return Done;
+
+    // Connection refused
+    return priv::SocketImpl::getErrorStatus();
+}
+
+
 ////////////////////////////////////////////////////////////
 void TcpSocket::disconnect()
 {
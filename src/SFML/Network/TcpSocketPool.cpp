@@ -0,0 +1,288 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/TcpSocketPool.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/SocketImpl.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <algorithm>
+
+
+namespace
+{
+    // Interval at which the connections that don't fit in a selector are checked
+    const sf::Time pollInterval = sf::milliseconds(10);
+
+    // Tell whether a selector already watching a given number of sockets can
+    // watch another one; this mirrors the FD_SETSIZE limits of sf::SocketSelector
+    bool fitsInSelector(sf::SocketHandle handle, std::size_t count)
+    {
+    #if defined(SFML_SYSTEM_WINDOWS)
+
+        // Windows limits the number of sockets in a set
+        (void)handle;
+        return count < FD_SETSIZE;
+
+    #else
+
+        // Other systems limit the value of the handles
+        (void)count;
+        return handle < FD_SETSIZE;
+
+    #endif
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TcpSocketPool::TcpSocketPool()
+{
+
+}
+
+
+////////////////////////////////////////////////////////////
+TcpSocketPool::~TcpSocketPool()
+{
+    clear();
+}
+
+
+////////////////////////////////////////////////////////////
+TcpSocket* TcpSocketPool::acquire(const IpAddress& remoteAddress, unsigned short remotePort, Time timeout)
+{
+    // Look for an idle connection that is still alive
+    SocketTable::iterator it = m_idleSockets.find(Key(remoteAddress, remotePort));
+    if (it != m_idleSockets.end())
+    {
+        std::vector<TcpSocket*>& sockets = it->second;
+        while (!sockets.empty())
+        {
+            TcpSocket* socket = sockets.back();
+            sockets.pop_back();
+
+            if (!isClosed(*socket))
+                return socket;
+
+            delete socket;
+        }
+    }
+
+    // None available: establish a new connection
+    TcpSocket* socket = new TcpSocket;
+    if (socket->connect(remoteAddress, remotePort, timeout) != Socket::Done)
+    {
+        delete socket;
+        return NULL;
+    }
+
+    return socket;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocketPool::release(TcpSocket* socket)
+{
+    if (!socket)
+        return;
+
+    IpAddress address = socket->getRemoteAddress();
+    if (address == IpAddress::None)
+    {
+        // The socket is no longer connected, it can't be reused
+        delete socket;
+        return;
+    }
+
+    m_idleSockets[Key(address, socket->getRemotePort())].push_back(socket);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TcpSocketPool::open(const IpAddress& remoteAddress, unsigned short remotePort, std::size_t count, Time timeout)
+{
+    std::vector<TcpSocket*>& idleSockets = m_idleSockets[Key(remoteAddress, remotePort)];
+    std::size_t opened = 0;
+
+    // Start all the connections at once; the ones that don't fit in the
+    // selector are checked one by one at regular intervals instead
+    std::vector<TcpSocket*> pending;
+    std::vector<bool> watched;
+    std::size_t watchedCount = 0;
+    SocketSelector selector;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        TcpSocket* socket = new TcpSocket;
+        socket->setBlocking(false);
+
+        Socket::Status status = socket->connect(remoteAddress, remotePort);
+        if (status == Socket::Done)
+        {
+            // We got instantly connected
+            socket->setBlocking(true);
+            idleSockets.push_back(socket);
+            ++opened;
+        }
+        else if (status == Socket::NotReady)
+        {
+            // The connection is in progress
+            bool fits = fitsInSelector(socket->getHandle(), watchedCount);
+            if (fits)
+            {
+                selector.addForSending(*socket);
+                ++watchedCount;
+            }
+
+            pending.push_back(socket);
+            watched.push_back(fits);
+        }
+        else
+        {
+            // The connection failed
+            delete socket;
+        }
+    }
+
+    // Wait for the connections to complete
+    Clock clock;
+    while (!pending.empty())
+    {
+        // Compute the time left before the timeout
+        Time remaining = Time::Zero;
+        if (timeout != Time::Zero)
+        {
+            remaining = timeout - clock.getElapsedTime();
+            if (remaining <= Time::Zero)
+                break;
+        }
+
+        // Don't block on the selector while some connections can only be polled
+        bool polling = watchedCount < pending.size();
+        if (polling)
+            remaining = (remaining == Time::Zero) ? pollInterval : std::min(remaining, pollInterval);
+
+        if (watchedCount == 0)
+        {
+            // An empty selector can't be waited on (Windows rejects empty sets)
+            sleep(remaining);
+        }
+        else if (!selector.wait(remaining) && !polling)
+        {
+            break;
+        }
+
+        // Collect the connections whose result is known
+        for (std::size_t i = 0; i < pending.size();)
+        {
+            TcpSocket* socket = pending[i];
+            if (watched[i] && !selector.isReadyToSend(*socket))
+            {
+                ++i;
+                continue;
+            }
+
+            Socket::Status status = socket->finishConnect();
+            if (status == Socket::NotReady)
+            {
+                ++i;
+                continue;
+            }
+
+            if (watched[i])
+            {
+                selector.remove(*socket);
+                --watchedCount;
+            }
+
+            pending[i] = pending.back();
+            pending.pop_back();
+            watched[i] = watched.back();
+            watched.pop_back();
+
+            if (status == Socket::Done)
+            {
+                socket->setBlocking(true);
+                idleSockets.push_back(socket);
+                ++opened;
+            }
+            else
+            {
+                delete socket;
+            }
+        }
+    }
+
+    // Abandon the connections that didn't complete in time
+    for (std::vector<TcpSocket*>::iterator it = pending.begin(); it != pending.end(); ++it)
+        delete *it;
+
+    return opened;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TcpSocketPool::getIdleCount(const IpAddress& remoteAddress, unsigned short remotePort) const
+{
+    SocketTable::const_iterator it = m_idleSockets.find(Key(remoteAddress, remotePort));
+    return (it != m_idleSockets.end()) ? it->second.size() : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocketPool::isClosed(TcpSocket& socket)
+{
+    SocketHandle handle = socket.getHandle();
+    if (handle == priv::SocketImpl::invalidSocket())
+        return true;
+
+    // An idle connection is only readable if the peer closed it (or sent unexpected data)
+    if (priv::SocketImpl::checkReady(handle, false) <= 0)
+        return false;
+
+    // Peek at the available data: nothing means that the connection was closed
+    char buffer;
+    return recv(handle, &buffer, 1, MSG_PEEK) <= 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocketPool::clear()
+{
+    for (SocketTable::iterator it = m_idleSockets.begin(); it != m_idleSockets.end(); ++it)
+    {
+        for (std::vector<TcpSocket*>::iterator socket = it->second.begin(); socket != it->second.end(); ++socket)
+            delete *socket;
+    }
+
+    m_idleSockets.clear();
+}
+
+} // namespace sf
@@ -29,6 +29,7 @@
 #include <SFML/System/Err.hpp>
 #include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <cstring>
 
 
@@ -85,6 +86,24 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+int SocketImpl::checkReady(SocketHandle sock, bool forWriting, Time timeout)
+{
+    // Use poll rather than select, which can't handle descriptors above FD_SETSIZE
+    pollfd descriptor;
+    descriptor.fd      = sock;
+    descriptor.events  = forWriting ? POLLOUT : POLLIN;
+    descriptor.revents = 0;
+
+    // Round the timeout up, so that we never return before it expired
+    int count = poll(&descriptor, 1, static_cast<int>((timeout.asMicroseconds() + 999) / 1000));
+    if (count < 0)
+        return (errno == EINTR) ? 0 : -1;
+
+    return (count > 0) ? 1 : 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
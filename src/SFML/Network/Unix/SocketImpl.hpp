@@ -29,6 +29,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Socket.hpp>
+#include <SFML/System/Time.hpp>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
@@ -92,6 +93,23 @@ public:
     ////////////////////////////////////////////////////////////
     static void setBlocking(SocketHandle sock, bool block);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until a socket is ready, or the timeout expires
+    ///
+    /// Unlike a selector, this function works with any socket
+    /// handle, including the ones above the FD_SETSIZE limit.
+    /// When checking for writing, a socket whose connection
+    /// failed is reported as ready too.
+    ///
+    /// \param sock       Handle of the socket
+    /// \param forWriting True to check for writing, false for reading
+    /// \param timeout    Maximum time to wait (Time::Zero to return immediately)
+    ///
+    /// \return 1 if the socket is ready, 0 if not, -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    static int checkReady(SocketHandle sock, bool forWriting, Time timeout = Time::Zero);
+
     ////////////////////////////////////////////////////////////
     /// Get the last socket error status
     ///
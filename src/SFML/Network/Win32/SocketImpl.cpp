@@ -28,6 +28,10 @@
 #include <SFML/Network/Win32/SocketImpl.hpp>
 #include <cstring>
 
+#ifdef _MSC_VER
+    #pragma warning(disable: 4127) // "conditional expression is constant" generated by the FD_SET macro
+#endif
+
 
 namespace sf
 {
@@ -68,6 +72,32 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+int SocketImpl::checkReady(SocketHandle sock, bool forWriting, Time timeout)
+{
+    // Windows sets are arrays of handles, so a single socket always fits
+    // in them whatever its value; failed connections are reported in the
+    // error set rather than in the write set
+    fd_set selector;
+    fd_set errorSelector;
+    FD_ZERO(&selector);
+    FD_ZERO(&errorSelector);
+    FD_SET(sock, &selector);
+    FD_SET(sock, &errorSelector);
+
+    timeval time;
+    time.tv_sec  = static_cast<long>(timeout.asMicroseconds() / 1000000);
+    time.tv_usec = static_cast<long>(timeout.asMicroseconds() % 1000000);
+
+    int count = forWriting ? select(0, NULL, &selector, &errorSelector, &time)
+                           : select(0, &selector, NULL, NULL, &time);
+    if (count < 0)
+        return -1;
+
+    return (count > 0) ? 1 : 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
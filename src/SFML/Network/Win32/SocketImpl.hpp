@@ -37,6 +37,7 @@
 #define _WIN32_WINDOWS 0x0501
 #define _WIN32_WINNT   0x0501
 #include <SFML/Network/Socket.hpp>
+#include <SFML/System/Time.hpp>
 #include <winsock2.h>
 #include <ws2tcpip.h>
 
@@ -95,6 +96,23 @@ public:
     ////////////////////////////////////////////////////////////
     static void setBlocking(SocketHandle sock, bool block);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until a socket is ready, or the timeout expires
+    ///
+    /// Unlike a selector, this function works with any socket
+    /// handle, including the ones above the FD_SETSIZE limit.
+    /// When checking for writing, a socket whose connection
+    /// failed is reported as ready too.
+    ///
+    /// \param sock       Handle of the socket
+    /// \param forWriting True to check for writing, false for reading
+    /// \param timeout    Maximum time to wait (Time::Zero to return immediately)
+    ///
+    /// \return 1 if the socket is ready, 0 if not, -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    static int checkReady(SocketHandle sock, bool forWriting, Time timeout = Time::Zero);
+
     ////////////////////////////////////////////////////////////
     /// Get the last socket error status
     ///
@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/FramePacer.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+    #include <SFML/System/Win32/ClockImpl.hpp>
+    #include <SFML/System/Win32/SleepImpl.hpp>
+#else
+    #include <SFML/System/Unix/ClockImpl.hpp>
+    #include <SFML/System/Unix/SleepImpl.hpp>
+#endif
+
+
+namespace
+{
+    // Time spent spinning before a deadline, to absorb the wake-up latency of the scheduler;
+    // Windows sleeps with a granularity of a millisecond, so it needs a larger margin
+#if defined(SFML_SYSTEM_WINDOWS)
+    const sf::Time spinTime = sf::microseconds(2000);
+#else
+    const sf::Time spinTime = sf::microseconds(500);
+#endif
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+FramePacer::FramePacer() :
+m_frameTime  (Time::Zero),
+m_deadline   (Time::Zero),
+m_lastFrame  (priv::ClockImpl::getCurrentTime()),
+m_sampleCount(0),
+m_nextSample (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::setFrameTime(Time frameTime)
+{
+    m_frameTime = frameTime > Time::Zero ? frameTime : Time::Zero;
+    m_deadline = priv::ClockImpl::getCurrentTime() + m_frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::getFrameTime() const
+{
+    return m_frameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::wait()
+{
+    if (m_frameTime != Time::Zero)
+    {
+        Time now = priv::ClockImpl::getCurrentTime();
+
+        if (now > m_deadline + m_frameTime)
+        {
+            // Too late to catch up: restart the schedule from now
+            m_deadline = now;
+        }
+        else
+        {
+            // Sleep until shortly before the deadline, then spin until it is reached
+            if (m_deadline - now > spinTime)
+                priv::sleepUntilImpl(m_deadline - spinTime);
+
+            while (priv::ClockImpl::getCurrentTime() < m_deadline)
+            {
+            }
+        }
+
+        m_deadline += m_frameTime;
+    }
+
+    // Record the duration of the frame
+    Time now = priv::ClockImpl::getCurrentTime();
+    m_samples[m_nextSample] = now - m_lastFrame;
+    m_nextSample = (m_nextSample + 1) % SampleCount;
+    m_sampleCount = std::min<std::size_t>(m_sampleCount + 1, SampleCount);
+    m_lastFrame = now;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::getAverageFrameTime() const
+{
+    if (m_sampleCount == 0)
+        return Time::Zero;
+
+    Int64 total = 0;
+    for (std::size_t i = 0; i < m_sampleCount; ++i)
+        total += m_samples[i].asMicroseconds();
+
+    return microseconds(total / static_cast<Int64>(m_sampleCount));
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::getFrameTimePercentile(float percentile) const
+{
+    if (m_sampleCount == 0)
+        return Time::Zero;
+
+    // Nearest-rank percentile
+    percentile = std::max(0.f, std::min(percentile, 100.f));
+    std::size_t rank = static_cast<std::size_t>(std::ceil(percentile / 100.f * m_sampleCount));
+    std::size_t index = rank > 0 ? rank - 1 : 0;
+
+    std::vector<Time> samples(m_samples, m_samples + m_sampleCount);
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+
+    return samples[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::resetStatistics()
+{
+    m_sampleCount = 0;
+    m_nextSample = 0;
+    m_lastFrame = priv::ClockImpl::getCurrentTime();
+}
+
+} // namespace sf
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <cstring>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+    #include <SFML/System/Win32/MappedFileImpl.hpp>
+#else
+    #include <SFML/System/Unix/MappedFileImpl.hpp>
+#endif
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+MappedFileInputStream::MappedFileInputStream() :
+m_impl  (NULL),
+m_offset(0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream::~MappedFileInputStream()
+{
+    delete m_impl;
+}
+
+
+////////////////////////////////////////////////////////////
+bool MappedFileInputStream::open(const std::string& filename)
+{
+    delete m_impl;
+    m_impl = new priv::MappedFileImpl;
+    m_offset = 0;
+
+    if (!m_impl->open(filename))
+    {
+        delete m_impl;
+        m_impl = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+const void* MappedFileInputStream::getData() const
+{
+    return m_impl ? m_impl->getData() : NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+Int64 MappedFileInputStream::read(void* data, Int64 size)
+{
+    if (!m_impl)
+        return -1;
+
+    Int64 available = static_cast<Int64>(m_impl->getSize()) - m_offset;
+    Int64 count = size <= available ? size : available;
+
+    if (count > 0)
+    {
+        std::memcpy(data, static_cast<const char*>(m_impl->getData()) + m_offset, static_cast<std::size_t>(count));
+        m_offset += count;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+Int64 MappedFileInputStream::seek(Int64 position)
+{
+    if (!m_impl)
+        return -1;
+
+    Int64 size = static_cast<Int64>(m_impl->getSize());
+    m_offset = position < size ? position : size;
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+Int64 MappedFileInputStream::tell()
+{
+    if (!m_impl)
+        return -1;
+
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+Int64 MappedFileInputStream::getSize()
+{
+    if (!m_impl)
+        return -1;
+
+    return static_cast<Int64>(m_impl->getSize());
+}
+
+} // namespace sf
@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/PackArchive.hpp>
+#include <SFML/System/PackFormat.hpp>
+#include <SFML/System/Err.hpp>
+#include <cstring>
+
+
+namespace
+{
+    sf::Uint32 readUint32(const sf::Uint8* data)
+    {
+        return static_cast<sf::Uint32>(data[0])       |
+               static_cast<sf::Uint32>(data[1]) << 8  |
+               static_cast<sf::Uint32>(data[2]) << 16 |
+               static_cast<sf::Uint32>(data[3]) << 24;
+    }
+
+    sf::Uint64 readUint64(const sf::Uint8* data)
+    {
+        return static_cast<sf::Uint64>(readUint32(data)) | static_cast<sf::Uint64>(readUint32(data + 4)) << 32;
+    }
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PackArchive::PackArchive()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool PackArchive::open(const std::string& filename)
+{
+    m_entries.clear();
+
+    if (!m_file.open(filename))
+    {
+        err() << "Failed to open pack archive \"" << filename << "\" (couldn't open file)" << std::endl;
+        return false;
+    }
+
+    const Uint8* data = static_cast<const Uint8*>(m_file.getData());
+    Uint64 fileSize = static_cast<Uint64>(m_file.getSize());
+
+    // Read and check the header
+    if ((fileSize < priv::PackFormat::HeaderSize) || (std::memcmp(data, "SFPK", 4) != 0))
+    {
+        err() << "Failed to open pack archive \"" << filename << "\" (not a pack file)" << std::endl;
+        return false;
+    }
+
+    Uint32 version = readUint32(data + 4);
+    if (version != priv::PackFormat::Version)
+    {
+        err() << "Failed to open pack archive \"" << filename << "\" (unsupported version " << version << ")" << std::endl;
+        return false;
+    }
+
+    Uint64 entryCount = readUint32(data + 8);
+    Uint64 namesSize = readUint32(data + 12);
+    Uint64 namesOffset = priv::PackFormat::HeaderSize + entryCount * priv::PackFormat::EntrySize;
+    if (namesOffset + namesSize > fileSize)
+    {
+        err() << "Failed to open pack archive \"" << filename << "\" (truncated table of contents)" << std::endl;
+        return false;
+    }
+
+    // Read and check the table of contents
+    m_entries.resize(static_cast<std::size_t>(entryCount));
+    for (std::size_t i = 0; i < m_entries.size(); ++i)
+    {
+        const Uint8* source = data + priv::PackFormat::HeaderSize + i * priv::PackFormat::EntrySize;
+        Uint64 offset = readUint64(source);
+        Uint64 storedSize = readUint64(source + 8);
+        Uint64 size = readUint64(source + 16);
+        Uint32 nameOffset = readUint32(source + 24);
+        Uint32 nameLength = readUint32(source + 28);
+        Uint32 method = readUint32(source + 32);
+
+        // The decompressed size of LZ4 entries is bounded by the format's maximum
+        // ratio, so that a corrupted size can't make us allocate an absurd buffer
+        bool valid = (nameOffset <= namesSize) && (nameLength <= namesSize - nameOffset) &&
+                     (offset <= fileSize) && (storedSize <= fileSize - offset) &&
+                     (static_cast<std::size_t>(size) == size) &&
+                     (((method == priv::PackFormat::MethodLz4) && (size <= storedSize * priv::PackFormat::MaxLz4Ratio + 16)) ||
+                      ((method == priv::PackFormat::MethodRaw) && (storedSize == size)));
+
+        Entry& entry = m_entries[i];
+        entry.name = reinterpret_cast<const char*>(data + namesOffset + nameOffset);
+        entry.nameLength = nameLength;
+        entry.data = data + offset;
+        entry.storedSize = static_cast<std::size_t>(storedSize);
+        entry.size = static_cast<std::size_t>(size);
+        entry.method = method;
+
+        // Lookups rely on the entries being strictly sorted
+        if (valid && (i > 0))
+        {
+            const Entry& previous = m_entries[i - 1];
+            valid = priv::compareEntryNames(previous.name, previous.nameLength, entry.name, entry.nameLength) < 0;
+        }
+
+        if (!valid)
+        {
+            err() << "Failed to open pack archive \"" << filename << "\" (invalid entry " << i << ")" << std::endl;
+            m_entries.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PackArchive::contains(const std::string& name) const
+{
+    return find(name) != NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PackArchive::getEntryCount() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::string PackArchive::getEntryName(std::size_t index) const
+{
+    const Entry& entry = m_entries[index];
+    return std::string(entry.name, entry.nameLength);
+}
+
+
+////////////////////////////////////////////////////////////
+const PackArchive::Entry* PackArchive::find(const std::string& name) const
+{
+    std::size_t first = 0;
+    std::size_t last = m_entries.size();
+
+    while (first < last)
+    {
+        std::size_t middle = first + (last - first) / 2;
+        const Entry& entry = m_entries[middle];
+
+        int result = priv::compareEntryNames(entry.name, entry.nameLength, name.data(), name.size());
+        if (result == 0)
+            return &entry;
+        else if (result < 0)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+
+    return NULL;
+}
+
+} // namespace sf
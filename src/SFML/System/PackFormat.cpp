@@ -0,0 +1,226 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/PackFormat.hpp>
+#include <cstring>
+
+
+namespace
+{
+    // Parameters of the LZ4 block format
+    const std::size_t minMatch     = 4;  // Length of the shortest match
+    const std::size_t lastLiterals = 5;  // The last bytes of a block are always literals
+    const std::size_t matchLimit   = 12; // The last match must start before this many bytes from the end
+    const std::size_t maxOffset    = 65535;
+    const unsigned    hashLog      = 12;
+
+    sf::Uint32 read32(const sf::Uint8* data)
+    {
+        sf::Uint32 value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    sf::Uint32 hash(sf::Uint32 sequence)
+    {
+        return (sequence * 2654435761U) >> (32 - hashLog);
+    }
+
+    void writeLength(std::vector<sf::Uint8>& output, std::size_t length)
+    {
+        for (; length >= 255; length -= 255)
+            output.push_back(255);
+        output.push_back(static_cast<sf::Uint8>(length));
+    }
+
+    void writeSequence(std::vector<sf::Uint8>& output, const sf::Uint8* literals, std::size_t literalCount, std::size_t offset, std::size_t matchLength)
+    {
+        std::size_t matchCode = matchLength - minMatch;
+
+        sf::Uint8 token = static_cast<sf::Uint8>((literalCount < 15 ? literalCount : 15) << 4);
+        if (offset > 0)
+            token |= static_cast<sf::Uint8>(matchCode < 15 ? matchCode : 15);
+        output.push_back(token);
+
+        if (literalCount >= 15)
+            writeLength(output, literalCount - 15);
+        output.insert(output.end(), literals, literals + literalCount);
+
+        // The last sequence of a block only contains literals
+        if (offset == 0)
+            return;
+
+        output.push_back(static_cast<sf::Uint8>(offset & 0xFF));
+        output.push_back(static_cast<sf::Uint8>(offset >> 8));
+        if (matchCode >= 15)
+            writeLength(output, matchCode - 15);
+    }
+
+    bool readLength(const sf::Uint8* data, std::size_t size, std::size_t& position, std::size_t& length)
+    {
+        sf::Uint8 byte;
+        do
+        {
+            if (position >= size)
+                return false;
+            byte = data[position++];
+            length += byte;
+        }
+        while (byte == 255);
+
+        return true;
+    }
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+int compareEntryNames(const char* left, std::size_t leftLength, const char* right, std::size_t rightLength)
+{
+    std::size_t length = leftLength < rightLength ? leftLength : rightLength;
+    int result = length > 0 ? std::memcmp(left, right, length) : 0;
+    if (result != 0)
+        return result;
+
+    return leftLength < rightLength ? -1 : (leftLength > rightLength ? 1 : 0);
+}
+
+
+////////////////////////////////////////////////////////////
+void compressBlock(const Uint8* data, std::size_t size, std::vector<Uint8>& output)
+{
+    output.clear();
+    output.reserve(size + size / 255 + 16);
+
+    std::size_t anchor = 0;
+
+    if (size > matchLimit)
+    {
+        // Positions are stored plus one, so that zero means "no position"
+        std::vector<std::size_t> table(std::size_t(1) << hashLog, 0);
+
+        std::size_t end = size - matchLimit;
+        std::size_t matchEnd = size - lastLiterals;
+        std::size_t position = 0;
+
+        while (position < end)
+        {
+            Uint32 sequence = read32(data + position);
+            Uint32 slot = hash(sequence);
+            std::size_t candidate = table[slot];
+            table[slot] = position + 1;
+
+            if ((candidate == 0) || (position - (candidate - 1) > maxOffset) || (read32(data + candidate - 1) != sequence))
+            {
+                ++position;
+                continue;
+            }
+
+            std::size_t reference = candidate - 1;
+            std::size_t length = minMatch;
+            while ((position + length < matchEnd) && (data[reference + length] == data[position + length]))
+                ++length;
+
+            writeSequence(output, data + anchor, position - anchor, position - reference, length);
+
+            position += length;
+            anchor = position;
+        }
+    }
+
+    writeSequence(output, data + anchor, size - anchor, 0, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool decompressBlock(const Uint8* data, std::size_t size, Uint8* output, std::size_t outputSize)
+{
+    std::size_t input = 0;
+    std::size_t position = 0;
+
+    for (;;)
+    {
+        if (input >= size)
+            return false;
+
+        Uint8 token = data[input++];
+
+        // Copy the literals
+        std::size_t literalCount = token >> 4;
+        if ((literalCount == 15) && !readLength(data, size, input, literalCount))
+            return false;
+
+        if ((literalCount > size - input) || (literalCount > outputSize - position))
+            return false;
+
+        std::memcpy(output + position, data + input, literalCount);
+        input += literalCount;
+        position += literalCount;
+
+        // The block ends with literals
+        if (input == size)
+            return position == outputSize;
+
+        // Copy the match
+        if (size - input < 2)
+            return false;
+
+        std::size_t offset = data[input] | (data[input + 1] << 8);
+        input += 2;
+
+        if ((offset == 0) || (offset > position))
+            return false;
+
+        std::size_t length = token & 15;
+        if ((length == 15) && !readLength(data, size, input, length))
+            return false;
+        length += minMatch;
+
+        if (length > outputSize - position)
+            return false;
+
+        const Uint8* source = output + position - offset;
+        if (offset >= length)
+        {
+            std::memcpy(output + position, source, length);
+        }
+        else
+        {
+            // Overlapping match: the copy repeats the last bytes
+            for (std::size_t i = 0; i < length; ++i)
+                output[position + i] = source[i];
+        }
+        position += length;
+    }
+}
+
+} // namespace priv
+
+} // namespace sf
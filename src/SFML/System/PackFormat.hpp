@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_PACKFORMAT_HPP
+#define SFML_PACKFORMAT_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+#include <cstddef>
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+// Layout of a pack archive (all integers are little-endian):
+//
+// header  : "SFPK", version, entry count, size of the name table (4 x Uint32)
+// entries : entry count x 40 bytes, sorted by name
+//           offset, stored size, size (3 x Uint64)
+//           name offset, name length, method, reserved (4 x Uint32)
+// names   : concatenated entry names, not null-terminated
+// data    : contents of the entries, stored raw or LZ4-compressed
+////////////////////////////////////////////////////////////
+namespace PackFormat
+{
+    const Uint32      Version     = 1;
+    const std::size_t HeaderSize  = 16;
+    const std::size_t EntrySize   = 40;
+    const Uint32      MethodRaw   = 0;
+    const Uint32      MethodLz4   = 1;
+    const Uint64      MaxLz4Ratio = 255; ///< Maximum expansion of LZ4 data (one 255 length byte per 255 bytes)
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Compare two entry names
+///
+/// Names are compared byte per byte, so that the order
+/// doesn't depend on the locale or on the signedness of char.
+///
+/// \return Negative, zero or positive value if the first name
+///         is respectively lower, equal or greater than the second
+///
+////////////////////////////////////////////////////////////
+int compareEntryNames(const char* left, std::size_t leftLength, const char* right, std::size_t rightLength);
+
+////////////////////////////////////////////////////////////
+/// \brief Compress a block of data using the LZ4 block format
+///
+/// \param data   Data to compress
+/// \param size   Size of the data, in bytes
+/// \param output Vector that receives the compressed data
+///
+////////////////////////////////////////////////////////////
+void compressBlock(const Uint8* data, std::size_t size, std::vector<Uint8>& output);
+
+////////////////////////////////////////////////////////////
+/// \brief Decompress a block of data in the LZ4 block format
+///
+/// \param data       Compressed data
+/// \param size       Size of the compressed data, in bytes
+/// \param output     Buffer that receives the decompressed data
+/// \param outputSize Exact size of the decompressed data, in bytes
+///
+/// \return True on success, false if the data is corrupted
+///
+////////////////////////////////////////////////////////////
+bool decompressBlock(const Uint8* data, std::size_t size, Uint8* output, std::size_t outputSize);
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_PACKFORMAT_HPP
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/PackInputStream.hpp>
+#include <SFML/System/PackArchive.hpp>
+#include <SFML/System/PackFormat.hpp>
+#include <SFML/System/Err.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PackInputStream::PackInputStream()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool PackInputStream::open(const PackArchive& archive, const std::string& name)
+{
+    m_stream = MemoryInputStream();
+    m_buffer.clear();
+
+    const PackArchive::Entry* entry = archive.find(name);
+    if (!entry)
+    {
+        err() << "Failed to open pack entry \"" << name << "\" (not found)" << std::endl;
+        return false;
+    }
+
+    if (entry->method == priv::PackFormat::MethodRaw)
+    {
+        m_stream.open(entry->data, entry->size);
+        return true;
+    }
+
+    // Keep at least one byte so that the stream always has valid data
+    m_buffer.resize(entry->size > 0 ? entry->size : 1);
+    if (!priv::decompressBlock(entry->data, entry->storedSize, &m_buffer[0], entry->size))
+    {
+        err() << "Failed to open pack entry \"" << name << "\" (corrupted data)" << std::endl;
+        m_buffer.clear();
+        return false;
+    }
+
+    m_stream.open(&m_buffer[0], entry->size);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+Int64 PackInputStream::read(void* data, Int64 size)
+{
+    return m_stream.read(data, size);
+}
+
+
+////////////////////////////////////////////////////////////
+Int64 PackInputStream::seek(Int64 position)
+{
+    return m_stream.seek(position);
+}
+
+
+////////////////////////////////////////////////////////////
+Int64 PackInputStream::tell()
+{
+    return m_stream.tell();
+}
+
+
+////////////////////////////////////////////////////////////
+Int64 PackInputStream::getSize()
+{
+    return m_stream.getSize();
+}
+
+} // namespace sf
@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/PackWriter.hpp>
+#include <SFML/System/PackFormat.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+#include <SFML/System/Err.hpp>
+#include <algorithm>
+#include <fstream>
+
+
+namespace
+{
+    void writeUint32(std::ostream& stream, sf::Uint32 value)
+    {
+        char bytes[4];
+        for (int i = 0; i < 4; ++i)
+            bytes[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+        stream.write(bytes, 4);
+    }
+
+    void writeUint64(std::ostream& stream, sf::Uint64 value)
+    {
+        writeUint32(stream, static_cast<sf::Uint32>(value & 0xFFFFFFFF));
+        writeUint32(stream, static_cast<sf::Uint32>(value >> 32));
+    }
+
+    // Written location of an entry
+    struct Location
+    {
+        sf::Uint64 offset;
+        sf::Uint64 storedSize;
+        sf::Uint64 size;
+        sf::Uint32 nameOffset;
+        sf::Uint32 method;
+    };
+
+    // Orders entries by name, through their indices
+    template <typename T>
+    struct NameLess
+    {
+        NameLess(const std::vector<T>& list) : entries(list) {}
+
+        bool operator()(std::size_t left, std::size_t right) const
+        {
+            const std::string& a = entries[left].name;
+            const std::string& b = entries[right].name;
+            return sf::priv::compareEntryNames(a.data(), a.size(), b.data(), b.size()) < 0;
+        }
+
+        const std::vector<T>& entries;
+    };
+}
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PackWriter::PackWriter()
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void PackWriter::add(const std::string& name, const std::string& filename)
+{
+    m_entries.push_back(Entry());
+    m_entries.back().name = name;
+    m_entries.back().filename = filename;
+}
+
+
+////////////////////////////////////////////////////////////
+void PackWriter::add(const std::string& name, const void* data, std::size_t size)
+{
+    m_entries.push_back(Entry());
+    m_entries.back().name = name;
+    if (size > 0)
+        m_entries.back().data.assign(static_cast<const char*>(data), static_cast<const char*>(data) + size);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PackWriter::getEntryCount() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void PackWriter::clear()
+{
+    m_entries.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool PackWriter::save(const std::string& filename, bool compress) const
+{
+    // Sort the entries by name, so that the archive can look them up with a binary search
+    std::vector<std::size_t> order(m_entries.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), NameLess<Entry>(m_entries));
+
+    std::string names;
+    std::vector<Location> locations(order.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        const std::string& name = m_entries[order[i]].name;
+        if ((i > 0) && (name == m_entries[order[i - 1]].name))
+        {
+            err() << "Failed to save pack archive \"" << filename << "\" (duplicate entry \"" << name << "\")" << std::endl;
+            return false;
+        }
+
+        locations[i].nameOffset = static_cast<Uint32>(names.size());
+        names += name;
+    }
+
+    std::ofstream file(filename.c_str(), std::ios_base::binary);
+    if (!file)
+    {
+        err() << "Failed to save pack archive \"" << filename << "\" (couldn't open file)" << std::endl;
+        return false;
+    }
+
+    // Write the header, and reserve space for the table of contents which is only known at the end
+    file.write("SFPK", 4);
+    writeUint32(file, priv::PackFormat::Version);
+    writeUint32(file, static_cast<Uint32>(order.size()));
+    writeUint32(file, static_cast<Uint32>(names.size()));
+    file.write(std::string(order.size() * priv::PackFormat::EntrySize, '\0').data(), order.size() * priv::PackFormat::EntrySize);
+    file.write(names.data(), names.size());
+
+    // Write the contents of the entries
+    Uint64 offset = priv::PackFormat::HeaderSize + order.size() * priv::PackFormat::EntrySize + names.size();
+    std::vector<Uint8> compressed;
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        const Entry& entry = m_entries[order[i]];
+
+        MappedFileInputStream mapping;
+        const Uint8* data = NULL;
+        std::size_t size = 0;
+        if (!entry.filename.empty())
+        {
+            if (!mapping.open(entry.filename))
+            {
+                err() << "Failed to save pack archive \"" << filename << "\" (couldn't read \"" << entry.filename << "\")" << std::endl;
+                return false;
+            }
+            data = static_cast<const Uint8*>(mapping.getData());
+            size = static_cast<std::size_t>(mapping.getSize());
+        }
+        else if (!entry.data.empty())
+        {
+            data = reinterpret_cast<const Uint8*>(&entry.data[0]);
+            size = entry.data.size();
+        }
+
+        Location& location = locations[i];
+        location.offset = offset;
+        location.size = size;
+        location.method = priv::PackFormat::MethodRaw;
+
+        if (compress && (size > 0))
+        {
+            priv::compressBlock(data, size, compressed);
+            if (compressed.size() < size)
+            {
+                data = &compressed[0];
+                size = compressed.size();
+                location.method = priv::PackFormat::MethodLz4;
+            }
+        }
+
+        location.storedSize = size;
+        if (size > 0)
+            file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+        offset += size;
+    }
+
+    // Go back and write the table of contents
+    file.seekp(priv::PackFormat::HeaderSize);
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        const Location& location = locations[i];
+        writeUint64(file, location.offset);
+        writeUint64(file, location.storedSize);
+        writeUint64(file, location.size);
+        writeUint32(file, location.nameOffset);
+        writeUint32(file, static_cast<Uint32>(m_entries[order[i]].name.size()));
+        writeUint32(file, location.method);
+        writeUint32(file, 0);
+    }
+
+    file.close();
+    if (!file)
+    {
+        err() << "Failed to save pack archive \"" << filename << "\" (write error)" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace sf
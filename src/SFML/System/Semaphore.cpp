@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Semaphore.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Lock.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+Semaphore::Semaphore(unsigned int count) :
+m_mutex    (),
+m_available(),
+m_count    (count)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Semaphore::acquire()
+{
+    Lock lock(m_mutex);
+
+    while (m_count == 0)
+        m_available.wait(m_mutex);
+
+    --m_count;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Semaphore::acquire(Time timeout)
+{
+    Lock lock(m_mutex);
+
+    // Wake-ups may be spurious, so keep track of the time left
+    Clock clock;
+    while (m_count == 0)
+    {
+        Time remaining = timeout - clock.getElapsedTime();
+        if (remaining <= Time::Zero)
+            return false;
+
+        m_available.wait(m_mutex, remaining);
+    }
+
+    --m_count;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Semaphore::tryAcquire()
+{
+    Lock lock(m_mutex);
+
+    if (m_count == 0)
+        return false;
+
+    --m_count;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Semaphore::release(unsigned int count)
+{
+    Lock lock(m_mutex);
+
+    m_count += count;
+
+    if (count == 1)
+        m_available.notifyOne();
+    else if (count > 1)
+        m_available.notifyAll();
+}
+
+} // namespace sf
@@ -27,10 +27,119 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/System/String.hpp>
 #include <SFML/System/Utf.hpp>
+#include <SFML/System/Simd.hpp>
 #include <iterator>
 #include <cstring>
 
 
+namespace
+{
+    // Append a contiguous UTF-8 sequence to a UTF-32 string; the result
+    // is the same as Utf8::toUtf32, but runs of ASCII characters are
+    // widened 16 at a time when vector instructions are available
+    void appendUtf8(const sf::Uint8* begin, const sf::Uint8* end, std::basic_string<sf::Uint32>& output)
+    {
+        // Each code unit produces at most one code point
+        std::size_t offset = output.size();
+        output.resize(offset + static_cast<std::size_t>(end - begin));
+        if (begin == end)
+            return;
+
+        sf::Uint32* out = &output[offset];
+
+        while (begin < end)
+        {
+#if defined(SFML_SIMD_SSE2)
+
+            const __m128i zero = _mm_setzero_si128();
+            while (end - begin >= 16)
+            {
+                __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+                if (_mm_movemask_epi8(bytes) != 0)
+                    break;
+
+                __m128i low  = _mm_unpacklo_epi8(bytes, zero);
+                __m128i high = _mm_unpackhi_epi8(bytes, zero);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out),      _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4),  _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8),  _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(high, zero));
+                begin += 16;
+                out += 16;
+            }
+
+#elif defined(SFML_SIMD_NEON)
+
+            while (end - begin >= 16)
+            {
+                uint8x16_t bytes = vld1q_u8(begin);
+                uint64x2_t high = vreinterpretq_u64_u8(vandq_u8(bytes, vdupq_n_u8(0x80)));
+                if (vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1))
+                    break;
+
+                uint16x8_t low16  = vmovl_u8(vget_low_u8(bytes));
+                uint16x8_t high16 = vmovl_u8(vget_high_u8(bytes));
+                vst1q_u32(out,      vmovl_u16(vget_low_u16(low16)));
+                vst1q_u32(out + 4,  vmovl_u16(vget_high_u16(low16)));
+                vst1q_u32(out + 8,  vmovl_u16(vget_low_u16(high16)));
+                vst1q_u32(out + 12, vmovl_u16(vget_high_u16(high16)));
+                begin += 16;
+                out += 16;
+            }
+
+#endif
+
+            if (begin == end)
+                break;
+
+            // Decode the next character, and the following ones as long as they are not ASCII
+            if (*begin < 0x80)
+                *out++ = *begin++;
+            else
+                while ((begin < end) && (*begin >= 0x80))
+                    begin = sf::Utf8::decode(begin, end, *out++);
+        }
+
+        output.resize(static_cast<std::size_t>(out - &output[0]));
+    }
+
+    // Append an ANSI string to a UTF-32 string; the result is the same
+    // as Utf32::fromAnsi, but the locale's facet is retrieved only once
+    // instead of once per character
+    void appendAnsi(const char* begin, const char* end, std::basic_string<sf::Uint32>& output, const std::locale& locale)
+    {
+    #if defined(SFML_SYSTEM_WINDOWS) &&                       /* if Windows ... */                          \
+       (defined(__GLIBCPP__) || defined (__GLIBCXX__)) &&     /* ... and standard library is glibc++ ... */ \
+      !(defined(__SGI_STL_PORT) || defined(_STLPORT_VERSION)) /* ... and STLPort is not used on top of it */
+
+        // Utf32::decodeAnsi ignores the locale in this configuration
+        output.reserve(output.size() + static_cast<std::size_t>(end - begin));
+        sf::Utf32::fromAnsi(begin, end, std::back_inserter(output), locale);
+
+    #else
+
+        const std::ctype<wchar_t>& facet = std::use_facet< std::ctype<wchar_t> >(locale);
+
+        std::size_t offset = output.size();
+        output.resize(offset + static_cast<std::size_t>(end - begin));
+        sf::Uint32* out = &output[offset];
+
+        // Widen the characters by blocks, through a small buffer on the stack
+        wchar_t buffer[64];
+        while (begin < end)
+        {
+            const char* blockEnd = (end - begin > 64) ? begin + 64 : end;
+            facet.widen(begin, blockEnd, buffer);
+
+            for (const wchar_t* character = buffer; begin < blockEnd; ++begin)
+                *out++ = static_cast<sf::Uint32>(*character++);
+        }
+
+    #endif
+    }
+}
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -72,8 +181,7 @@ String::String(const char* ansiString, const std::locale& locale)
         std::size_t length = strlen(ansiString);
         if (length > 0)
         {
-            m_string.reserve(length + 1);
-            Utf32::fromAnsi(ansiString, ansiString + length, std::back_inserter(m_string), locale);
+            appendAnsi(ansiString, ansiString + length, m_string, locale);
         }
     }
 }
@@ -82,8 +190,8 @@ String::String(const char* ansiString, const std::locale& locale)
 ////////////////////////////////////////////////////////////
 String::String(const std::string& ansiString, const std::locale& locale)
 {
-    m_string.reserve(ansiString.length() + 1);
-    Utf32::fromAnsi(ansiString.begin(), ansiString.end(), std::back_inserter(m_string), locale);
+    if (!ansiString.empty())
+        appendAnsi(ansiString.data(), ansiString.data() + ansiString.size(), m_string, locale);
 }
 
 
@@ -132,6 +240,61 @@ m_string(copy.m_string)
 }
 
 
+////////////////////////////////////////////////////////////
+template <>
+String String::fromUtf8(const Uint8* begin, const Uint8* end)
+{
+    String string;
+    appendUtf8(begin, end, string.m_string);
+    return string;
+}
+
+
+////////////////////////////////////////////////////////////
+template <>
+String String::fromUtf8(Uint8* begin, Uint8* end)
+{
+    return fromUtf8(static_cast<const Uint8*>(begin), static_cast<const Uint8*>(end));
+}
+
+
+////////////////////////////////////////////////////////////
+template <>
+String String::fromUtf8(const char* begin, const char* end)
+{
+    return fromUtf8(reinterpret_cast<const Uint8*>(begin), reinterpret_cast<const Uint8*>(end));
+}
+
+
+////////////////////////////////////////////////////////////
+template <>
+String String::fromUtf8(char* begin, char* end)
+{
+    return fromUtf8(static_cast<const char*>(begin), static_cast<const char*>(end));
+}
+
+
+////////////////////////////////////////////////////////////
+template <>
+String String::fromUtf8(std::string::const_iterator begin, std::string::const_iterator end)
+{
+    // Don't dereference the iterators of an empty range
+    if (begin == end)
+        return String();
+
+    const char* first = &*begin;
+    return fromUtf8(first, first + (end - begin));
+}
+
+
+////////////////////////////////////////////////////////////
+template <>
+String String::fromUtf8(std::string::iterator begin, std::string::iterator end)
+{
+    return fromUtf8(std::string::const_iterator(begin), std::string::const_iterator(end));
+}
+
+
 ////////////////////////////////////////////////////////////
 String::operator std::string() const
 {
@@ -177,12 +340,81 @@ std::wstring String::toWideString() const
 ////////////////////////////////////////////////////////////
 std::basic_string<Uint8> String::toUtf8() const
 {
-    // Prepare the output string
-    std::basic_string<Uint8> output;
-    output.reserve(m_string.length());
+    // Compute the size of the output, so that it can be written directly
+    std::size_t size = 0;
+    for (std::basic_string<Uint32>::const_iterator it = m_string.begin(); it != m_string.end(); ++it)
+    {
+        Uint32 codepoint = *it;
+        if      (codepoint <  0x80)       size += 1;
+        else if (codepoint <  0x800)      size += 2;
+        else if ((codepoint >= 0xD800) && (codepoint <= 0xDBFF)) continue; // Invalid, skipped by Utf8::encode
+        else if (codepoint <  0x10000)    size += 3;
+        else if (codepoint <= 0x0010FFFF) size += 4;
+    }
 
-    // Convert
-    Utf32::toUtf8(m_string.begin(), m_string.end(), std::back_inserter(output));
+    std::basic_string<Uint8> output(size, 0);
+    if (size == 0)
+        return output;
+
+    const Uint32* begin = m_string.data();
+    const Uint32* end = begin + m_string.size();
+    Uint8* out = &output[0];
+
+    while (begin < end)
+    {
+#if defined(SFML_SIMD_SSE2)
+
+        // Narrow runs of ASCII characters 16 at a time
+        const __m128i highBits = _mm_set1_epi32(~0x7F);
+        while (end - begin >= 16)
+        {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + 4));
+            __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + 8));
+            __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + 12));
+            __m128i any = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), highBits);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, _mm_setzero_si128())) != 0xFFFF)
+                break;
+
+            __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), bytes);
+            begin += 16;
+            out += 16;
+        }
+
+#elif defined(SFML_SIMD_NEON)
+
+        // Narrow runs of ASCII characters 16 at a time
+        while (end - begin >= 16)
+        {
+            uint32x4_t a = vld1q_u32(begin);
+            uint32x4_t b = vld1q_u32(begin + 4);
+            uint32x4_t c = vld1q_u32(begin + 8);
+            uint32x4_t d = vld1q_u32(begin + 12);
+            uint32x4_t any = vandq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d)), vdupq_n_u32(~0x7FU));
+            uint64x2_t high = vreinterpretq_u64_u32(any);
+            if (vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1))
+                break;
+
+            uint16x8_t low16  = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+            uint16x8_t high16 = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+            vst1q_u8(out, vcombine_u8(vmovn_u16(low16), vmovn_u16(high16)));
+            begin += 16;
+            out += 16;
+        }
+
+#endif
+
+        if (begin == end)
+            break;
+
+        // Encode the next character, and the following ones as long as they are not ASCII
+        if (*begin < 0x80)
+            *out++ = static_cast<Uint8>(*begin++);
+        else
+            while ((begin < end) && (*begin >= 0x80))
+                out = Utf8::encode(*begin++, out);
+    }
 
     return output;
 }
@@ -246,6 +478,13 @@ void String::clear()
 }
 
 
+////////////////////////////////////////////////////////////
+void String::swap(String& right)
+{
+    m_string.swap(right.m_string);
+}
+
+
 ////////////////////////////////////////////////////////////
 std::size_t String::getSize() const
 {
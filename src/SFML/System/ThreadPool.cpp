@@ -0,0 +1,484 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/ThreadPool.hpp>
+#include <SFML/System/ThreadLocalPtr.hpp>
+#include <deque>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+    #include <SFML/System/Win32/ThreadImpl.hpp>
+#else
+    #include <SFML/System/Unix/ThreadImpl.hpp>
+#endif
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Shared state of a task, referenced by its handles
+///        and by the pool while it is queued or running
+///
+////////////////////////////////////////////////////////////
+class TaskState : NonCopyable
+{
+public:
+
+    TaskState(ThreadPool& taskPool, ThreadFunc* taskFunction, ThreadPool::Priority taskPriority) :
+    pool       (taskPool),
+    function   (taskFunction),
+    priority   (taskPriority),
+    isFinished (false),
+    references (2)
+    {
+    }
+
+    ~TaskState()
+    {
+        delete function;
+    }
+
+    ThreadPool&              pool;          ///< Pool running the task
+    ThreadFunc*              function;      ///< Function to run
+    ThreadPool::Priority     priority;      ///< Priority of the task
+    Mutex                    mutex;         ///< Mutex protecting the members below
+    ConditionVariable        finished;      ///< Signaled when the task is finished
+    bool                     isFinished;    ///< Has the task finished running?
+    unsigned int             references;    ///< Number of handles, queues and lists referencing the task
+    std::vector<TaskState*>  continuations; ///< Tasks to queue when this one is finished
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Worker thread of a pool, with its own task queues
+///
+////////////////////////////////////////////////////////////
+class ThreadPoolWorker : NonCopyable
+{
+public:
+
+    ThreadPoolWorker(ThreadPool& workerPool) :
+    pool  (workerPool),
+    thread(&ThreadPoolWorker::run, this)
+    {
+    }
+
+    void run();
+
+    ThreadPool&            pool;        ///< Pool owning the worker
+    Mutex                  mutex;       ///< Mutex protecting the queues
+    std::deque<TaskState*> queues[3];   ///< Queued tasks, one queue per priority
+    Thread                 thread;      ///< Thread running the worker loop
+};
+
+} // namespace priv
+} // namespace sf
+
+
+namespace
+{
+    // Worker that the current thread runs, NULL outside of the pools
+    sf::ThreadLocalPtr<sf::priv::ThreadPoolWorker> currentWorker(NULL);
+
+    void addReference(sf::priv::TaskState* state)
+    {
+        sf::Lock lock(state->mutex);
+        ++state->references;
+    }
+
+    void removeReference(sf::priv::TaskState* state)
+    {
+        bool isLast;
+
+        {
+            sf::Lock lock(state->mutex);
+            isLast = (--state->references == 0);
+        }
+
+        if (isLast)
+            delete state;
+    }
+}
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+void ThreadPoolWorker::run()
+{
+    currentWorker = this;
+
+    pool.runWorker(*this);
+}
+
+} // namespace priv
+
+
+////////////////////////////////////////////////////////////
+Task::Task() :
+m_state(NULL)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Task::Task(const Task& copy) :
+m_state(copy.m_state)
+{
+    if (m_state)
+        addReference(m_state);
+}
+
+
+////////////////////////////////////////////////////////////
+Task::Task(priv::TaskState* state) :
+m_state(state)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Task::~Task()
+{
+    if (m_state)
+        removeReference(m_state);
+}
+
+
+////////////////////////////////////////////////////////////
+Task& Task::operator =(const Task& right)
+{
+    if (right.m_state)
+        addReference(right.m_state);
+
+    if (m_state)
+        removeReference(m_state);
+
+    m_state = right.m_state;
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Task::isDone() const
+{
+    if (!m_state)
+        return true;
+
+    Lock lock(m_state->mutex);
+
+    return m_state->isFinished;
+}
+
+
+////////////////////////////////////////////////////////////
+void Task::wait()
+{
+    if (!m_state)
+        return;
+
+    // A worker waiting for a task makes itself useful in the meantime;
+    // otherwise, tasks waiting for other tasks could block all the workers
+    priv::ThreadPoolWorker* worker = currentWorker;
+    if (worker && (&worker->pool == &m_state->pool))
+    {
+        while (!isDone() && m_state->pool.runPendingTask(*worker))
+        {
+        }
+    }
+
+    Lock lock(m_state->mutex);
+
+    while (!m_state->isFinished)
+        m_state->finished.wait(m_state->mutex);
+}
+
+
+////////////////////////////////////////////////////////////
+Task Task::thenTask(priv::ThreadFunc* function)
+{
+    ThreadPool& pool = m_state->pool;
+
+    // The second reference belongs to the continuation list, then to the queue
+    priv::TaskState* state = new priv::TaskState(pool, function, m_state->priority);
+
+    {
+        Lock lock(pool.m_mutex);
+        ++pool.m_unfinishedCount;
+    }
+
+    bool isFinished;
+
+    {
+        Lock lock(m_state->mutex);
+
+        isFinished = m_state->isFinished;
+        if (!isFinished)
+            m_state->continuations.push_back(state);
+    }
+
+    if (isFinished)
+        pool.enqueue(state);
+
+    return Task(state);
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool() :
+m_pendingCount   (0),
+m_unfinishedCount(0),
+m_nextWorker     (0),
+m_isStopping     (false)
+{
+    initialize(getHardwareConcurrency());
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool::ThreadPool(unsigned int threadCount) :
+m_pendingCount   (0),
+m_unfinishedCount(0),
+m_nextWorker     (0),
+m_isStopping     (false)
+{
+    initialize(threadCount);
+}
+
+
+////////////////////////////////////////////////////////////
+ThreadPool::~ThreadPool()
+{
+    wait();
+
+    {
+        Lock lock(m_mutex);
+        m_isStopping = true;
+        m_taskAvailable.notifyAll();
+    }
+
+    for (std::size_t i = 0; i < m_workers.size(); ++i)
+    {
+        m_workers[i]->thread.wait();
+        delete m_workers[i];
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::wait()
+{
+    Lock lock(m_mutex);
+
+    while (m_unfinishedCount > 0)
+        m_allFinished.wait(m_mutex);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ThreadPool::getThreadCount() const
+{
+    return static_cast<unsigned int>(m_workers.size());
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ThreadPool::getHardwareConcurrency()
+{
+    return priv::ThreadImpl::getHardwareConcurrency();
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::initialize(unsigned int threadCount)
+{
+    if (threadCount < 1)
+        threadCount = 1;
+
+    // All the workers must exist before any of them starts stealing tasks
+    m_workers.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i)
+        m_workers.push_back(new priv::ThreadPoolWorker(*this));
+
+    for (unsigned int i = 0; i < threadCount; ++i)
+        m_workers[i]->thread.launch();
+}
+
+
+////////////////////////////////////////////////////////////
+Task ThreadPool::submitTask(priv::ThreadFunc* function, Priority priority)
+{
+    // The second reference belongs to the queue
+    priv::TaskState* state = new priv::TaskState(*this, function, priority);
+
+    {
+        Lock lock(m_mutex);
+        ++m_unfinishedCount;
+    }
+
+    enqueue(state);
+
+    return Task(state);
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::enqueue(priv::TaskState* state)
+{
+    // Tasks created by a worker stay on that worker, the others
+    // are spread over all the workers
+    priv::ThreadPoolWorker* worker = currentWorker;
+    if (!worker || (&worker->pool != this))
+    {
+        Lock lock(m_mutex);
+        worker = m_workers[m_nextWorker];
+        m_nextWorker = (m_nextWorker + 1) % m_workers.size();
+    }
+
+    {
+        Lock lock(worker->mutex);
+        worker->queues[state->priority].push_back(state);
+    }
+
+    // Only count the task once it is in a queue, so that a thread
+    // that reserves it is sure to find it
+    Lock lock(m_mutex);
+    ++m_pendingCount;
+    m_taskAvailable.notifyOne();
+}
+
+
+////////////////////////////////////////////////////////////
+priv::TaskState* ThreadPool::takeTask(priv::ThreadPoolWorker& worker)
+{
+    std::size_t workerCount = m_workers.size();
+    std::size_t start = 0;
+    while (m_workers[start] != &worker)
+        ++start;
+
+    // The reserved task is guaranteed to be in one of the queues, but
+    // other threads may take it first: then another one is available
+    for (;;)
+    {
+        for (int priority = High; priority >= Low; --priority)
+        {
+            // Look in our own queue first, then steal from the other workers
+            for (std::size_t i = 0; i < workerCount; ++i)
+            {
+                priv::ThreadPoolWorker& victim = *m_workers[(start + i) % workerCount];
+                Lock lock(victim.mutex);
+
+                std::deque<priv::TaskState*>& queue = victim.queues[priority];
+                if (!queue.empty())
+                {
+                    priv::TaskState* state = queue.front();
+                    queue.pop_front();
+                    return state;
+                }
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::runTask(priv::TaskState* state)
+{
+    state->function->run();
+
+    std::vector<priv::TaskState*> continuations;
+
+    {
+        Lock lock(state->mutex);
+
+        state->isFinished = true;
+        state->continuations.swap(continuations);
+        state->finished.notifyAll();
+    }
+
+    // Continuations were counted as unfinished when they were created,
+    // so the count can't drop to zero before they are queued
+    for (std::size_t i = 0; i < continuations.size(); ++i)
+        enqueue(continuations[i]);
+
+    {
+        Lock lock(m_mutex);
+
+        if (--m_unfinishedCount == 0)
+            m_allFinished.notifyAll();
+    }
+
+    // Release the reference held by the queue
+    removeReference(state);
+}
+
+
+////////////////////////////////////////////////////////////
+bool ThreadPool::runPendingTask(priv::ThreadPoolWorker& worker)
+{
+    {
+        Lock lock(m_mutex);
+
+        if (m_pendingCount == 0)
+            return false;
+
+        --m_pendingCount;
+    }
+
+    runTask(takeTask(worker));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void ThreadPool::runWorker(priv::ThreadPoolWorker& worker)
+{
+    for (;;)
+    {
+        // Reserve one of the pending tasks
+        {
+            Lock lock(m_mutex);
+
+            while ((m_pendingCount == 0) && !m_isStopping)
+                m_taskAvailable.wait(m_mutex);
+
+            if (m_pendingCount == 0)
+                return;
+
+            --m_pendingCount;
+        }
+
+        runTask(takeTask(worker));
+    }
+}
+
+} // namespace sf
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Unix/ConditionVariableImpl.hpp>
+#include <SFML/System/Unix/MutexImpl.hpp>
+#include <errno.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+ConditionVariableImpl::ConditionVariableImpl()
+{
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+
+#if defined(_POSIX_CLOCK_SELECTION) && (_POSIX_CLOCK_SELECTION > 0)
+    // Measure timeouts on the monotonic clock, so that they are
+    // not affected by changes of the system time
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+#endif
+
+    pthread_cond_init(&m_condition, &attributes);
+    pthread_condattr_destroy(&attributes);
+}
+
+
+////////////////////////////////////////////////////////////
+ConditionVariableImpl::~ConditionVariableImpl()
+{
+    pthread_cond_destroy(&m_condition);
+}
+
+
+////////////////////////////////////////////////////////////
+void ConditionVariableImpl::wait(MutexImpl& mutex)
+{
+    pthread_cond_wait(&m_condition, &mutex.m_mutex);
+}
+
+
+////////////////////////////////////////////////////////////
+bool ConditionVariableImpl::wait(MutexImpl& mutex, Time timeout)
+{
+    Int64 usecs = timeout.asMicroseconds();
+    if (usecs < 0)
+        usecs = 0;
+
+    // pthread wants an absolute deadline, on the clock selected in the constructor
+    timespec deadline;
+
+#if defined(_POSIX_CLOCK_SELECTION) && (_POSIX_CLOCK_SELECTION > 0)
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+#else
+    timeval now;
+    gettimeofday(&now, NULL);
+    deadline.tv_sec = now.tv_sec;
+    deadline.tv_nsec = now.tv_usec * 1000;
+#endif
+
+    deadline.tv_sec += static_cast<time_t>(usecs / 1000000);
+    deadline.tv_nsec += static_cast<long>(usecs % 1000000) * 1000;
+    if (deadline.tv_nsec >= 1000000000)
+    {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000;
+    }
+
+    return pthread_cond_timedwait(&m_condition, &mutex.m_mutex, &deadline) != ETIMEDOUT;
+}
+
+
+////////////////////////////////////////////////////////////
+void ConditionVariableImpl::notifyOne()
+{
+    pthread_cond_signal(&m_condition);
+}
+
+
+////////////////////////////////////////////////////////////
+void ConditionVariableImpl::notifyAll()
+{
+    pthread_cond_broadcast(&m_condition);
+}
+
+} // namespace priv
+
+} // namespace sf
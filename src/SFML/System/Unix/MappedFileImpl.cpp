@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Unix/MappedFileImpl.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+MappedFileImpl::MappedFileImpl() :
+m_data(NULL),
+m_size(0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileImpl::~MappedFileImpl()
+{
+    close();
+}
+
+
+////////////////////////////////////////////////////////////
+bool MappedFileImpl::open(const std::string& filename)
+{
+    close();
+
+    int file = ::open(filename.c_str(), O_RDONLY);
+    if (file < 0)
+        return false;
+
+    struct stat info;
+    if ((fstat(file, &info) != 0) || !S_ISREG(info.st_mode) ||
+        (static_cast<unsigned long long>(info.st_size) > static_cast<std::size_t>(-1)))
+    {
+        ::close(file);
+        return false;
+    }
+
+    // Empty files can't be mapped, but they are still valid
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    if (size > 0)
+    {
+        void* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data == MAP_FAILED)
+        {
+            ::close(file);
+            return false;
+        }
+
+        m_data = data;
+        m_size = size;
+    }
+
+    // The mapping stays valid after the file descriptor is closed
+    ::close(file);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void MappedFileImpl::close()
+{
+    if (m_data)
+        munmap(m_data, m_size);
+
+    m_data = NULL;
+    m_size = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+const void* MappedFileImpl::getData() const
+{
+    return m_data;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t MappedFileImpl::getSize() const
+{
+    return m_size;
+}
+
+} // namespace priv
+
+} // namespace sf
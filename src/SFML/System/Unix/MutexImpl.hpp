@@ -71,6 +71,8 @@ public:
 
 private:
 
+    friend class ConditionVariableImpl;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
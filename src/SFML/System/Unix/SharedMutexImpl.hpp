@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SHAREDMUTEXIMPL_HPP
+#define SFML_SHAREDMUTEXIMPL_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/NonCopyable.hpp>
+#include <pthread.h>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Unix implementation of shared mutexes
+////////////////////////////////////////////////////////////
+class SharedMutexImpl : NonCopyable
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SharedMutexImpl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SharedMutexImpl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Lock the mutex for exclusive access
+    ///
+    ////////////////////////////////////////////////////////////
+    void lock();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release an exclusive lock
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlock();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Lock the mutex for shared access
+    ///
+    ////////////////////////////////////////////////////////////
+    void lockShared();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release a shared lock
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlockShared();
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    pthread_rwlock_t m_lock; ///< pthread handle of the read-write lock
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_SHAREDMUTEXIMPL_HPP
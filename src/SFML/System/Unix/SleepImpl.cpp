@@ -26,8 +26,10 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Unix/SleepImpl.hpp>
+#include <SFML/System/Unix/ClockImpl.hpp>
 #include <errno.h>
 #include <time.h>
+#include <unistd.h>
 
 
 namespace sf
@@ -54,6 +56,40 @@ void sleepImpl(Time time)
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void sleepUntilImpl(Time time)
+{
+#if defined(_POSIX_CLOCK_SELECTION) && (_POSIX_CLOCK_SELECTION > 0)
+
+    if (time <= Time::Zero)
+        return;
+
+    Uint64 usecs = time.asMicroseconds();
+
+    // Construct the time to wake up at, on the same clock as ClockImpl
+    timespec ti;
+    ti.tv_nsec = (usecs % 1000000) * 1000;
+    ti.tv_sec = usecs / 1000000;
+
+    // Wait...
+    // The deadline is absolute, so an interrupted wait can simply be
+    // restarted, and time spent between reading the clock and going
+    // to sleep doesn't delay the wake-up.
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ti, NULL) == EINTR)
+    {
+    }
+
+#else
+
+    // No absolute sleep on this system (macOS, iOS): sleep for the remaining time
+    Time remaining = time - ClockImpl::getCurrentTime();
+    if (remaining > Time::Zero)
+        sleepImpl(remaining);
+
+#endif
+}
+
 } // namespace priv
 
 } // namespace sf
@@ -44,6 +44,14 @@ namespace priv
 ////////////////////////////////////////////////////////////
 void sleepImpl(Time time);
 
+////////////////////////////////////////////////////////////
+/// \brief Unix implementation of sleeping until an absolute time
+///
+/// \param time Time to wake up at, in the time base of priv::ClockImpl
+///
+////////////////////////////////////////////////////////////
+void sleepUntilImpl(Time time);
+
 } // namespace priv
 
 } // namespace sf
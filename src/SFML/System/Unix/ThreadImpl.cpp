@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Unix/ThreadImpl.hpp>
 #include <SFML/System/Thread.hpp>
+#include <unistd.h>
 #include <iostream>
 #include <cassert>
 
@@ -72,6 +73,15 @@ void ThreadImpl::terminate()
 }
 
 
+////////////////////////////////////////////////////////////
+unsigned int ThreadImpl::getHardwareConcurrency()
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (count > 0) ? static_cast<unsigned int>(count) : 1;
+}
+
+
 ////////////////////////////////////////////////////////////
 void* ThreadImpl::entryPoint(void* userData)
 {
@@ -66,6 +66,15 @@ public:
     ////////////////////////////////////////////////////////////
     void terminate();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads that the hardware can
+    ///        run concurrently
+    ///
+    /// \return Number of logical processors, at least 1
+    ///
+    ////////////////////////////////////////////////////////////
+    static unsigned int getHardwareConcurrency();
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Win32/SleepImpl.hpp>
+#include <SFML/System/Win32/ClockImpl.hpp>
 #include <windows.h>
 
 
@@ -50,6 +51,16 @@ void sleepImpl(Time time)
     timeEndPeriod(tc.wPeriodMin);
 }
 
+
+////////////////////////////////////////////////////////////
+void sleepUntilImpl(Time time)
+{
+    // Windows has no absolute sleep: sleep for the remaining time
+    Time remaining = time - ClockImpl::getCurrentTime();
+    if (remaining > Time::Zero)
+        sleepImpl(remaining);
+}
+
 } // namespace priv
 
 } // namespace sf
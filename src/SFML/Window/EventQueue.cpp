@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/EventQueue.hpp>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+EventQueue::EventQueue() :
+m_events(16),
+m_first (0),
+m_count (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool EventQueue::isEmpty() const
+{
+    return m_count == 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void EventQueue::push(const Event& event)
+{
+    std::size_t mask = m_events.size() - 1;
+
+    // Grow the buffer when it is full, moving the events back in order
+    if (m_count == m_events.size())
+    {
+        std::vector<Event> events(m_events.size() * 2);
+        for (std::size_t i = 0; i < m_count; ++i)
+            events[i] = m_events[(m_first + i) & mask];
+
+        m_events.swap(events);
+        m_first = 0;
+        mask = m_events.size() - 1;
+    }
+
+    m_events[(m_first + m_count) & mask] = event;
+    ++m_count;
+}
+
+
+////////////////////////////////////////////////////////////
+bool EventQueue::pop(Event& event)
+{
+    if (m_count == 0)
+        return false;
+
+    event = m_events[m_first];
+    m_first = (m_first + 1) & (m_events.size() - 1);
+    --m_count;
+
+    return true;
+}
+
+} // namespace priv
+
+} // namespace sf
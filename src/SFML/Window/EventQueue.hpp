@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_EVENTQUEUE_HPP
+#define SFML_EVENTQUEUE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Event.hpp>
+#include <cstddef>
+#include <vector>
+
+
+namespace sf
+{
+namespace priv
+{
+////////////////////////////////////////////////////////////
+/// \brief First-in first-out queue of window events
+///
+/// Events are stored in a ring buffer which only grows when
+/// it is full, so that pushing and popping events doesn't
+/// allocate anything once the queue has reached its working
+/// size.
+///
+////////////////////////////////////////////////////////////
+class EventQueue
+{
+public:
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    EventQueue();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the queue is empty
+    ///
+    /// \return True if there's no event in the queue
+    ///
+    ////////////////////////////////////////////////////////////
+    bool isEmpty() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an event at the back of the queue
+    ///
+    /// \param event Event to add
+    ///
+    ////////////////////////////////////////////////////////////
+    void push(const Event& event);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove the event at the front of the queue
+    ///
+    /// \param event Event to fill with the removed event
+    ///
+    /// \return True if an event was removed, false if the queue was empty
+    ///
+    ////////////////////////////////////////////////////////////
+    bool pop(Event& event);
+
+private:
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Event> m_events; ///< Ring buffer of events; its size is always a power of two
+    std::size_t        m_first;  ///< Index of the front event
+    std::size_t        m_count;  ///< Number of events in the queue
+};
+
+} // namespace priv
+
+} // namespace sf
+
+
+#endif // SFML_EVENTQUEUE_HPP
@@ -31,7 +31,9 @@
 #include <libudev.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <errno.h>
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <cstring>
@@ -64,6 +66,11 @@ bool JoystickImpl::isConnected(unsigned int index)
     return false;
 }
 
+bool JoystickImpl::getWaitDescriptors(std::vector<int>& descriptors)
+{
+    return true;
+}
+
 ////////////////////////////////////////////////////////////
 bool JoystickImpl::open(unsigned int index)
 {
@@ -112,6 +119,9 @@ namespace
     typedef std::vector<JoystickRecord> JoystickList;
     JoystickList joystickList;
 
+    // File descriptors of the open joysticks
+    std::vector<int> openFiles;
+
     bool isJoystick(udev_device* udevDevice)
     {
         // If anything goes wrong, we go safe and return true
@@ -312,15 +322,12 @@ namespace
     bool hasMonitorEvent()
     {
         // This will not fail since we make sure udevMonitor is valid
-        int monitorFd = udev_monitor_get_fd(udevMonitor);
-
-        fd_set descriptorSet;
-        FD_ZERO(&descriptorSet);
-        FD_SET(monitorFd, &descriptorSet);
-        timeval timeout = {0, 0};
+        pollfd descriptor;
+        descriptor.fd = udev_monitor_get_fd(udevMonitor);
+        descriptor.events = POLLIN;
+        descriptor.revents = 0;
 
-        return (select(monitorFd + 1, &descriptorSet, NULL, NULL, &timeout) > 0) &&
-               FD_ISSET(monitorFd, &descriptorSet);
+        return (poll(&descriptor, 1, 0) > 0) && (descriptor.revents & POLLIN);
     }
 
     // Get a property value from a udev device
@@ -583,17 +590,24 @@ bool JoystickImpl::isConnected(unsigned int index)
         // udev monitor is not available, perform a scan every query
         updatePluggedList();
     }
-    else if (hasMonitorEvent())
+    else
     {
-        // Check if new joysticks were added/removed since last update
-        udev_device* udevDevice = udev_monitor_receive_device(udevMonitor);
+        // Check if new joysticks were added/removed since last update;
+        // consume all the pending notifications at once, so that the
+        // other slots don't have to go through them one by one
+        while (hasMonitorEvent())
+        {
+            udev_device* udevDevice = udev_monitor_receive_device(udevMonitor);
 
-        // If we can get the specific device, we check that,
-        // otherwise just do a full scan if udevDevice == NULL
-        updatePluggedList(udevDevice);
+            // If we can get the specific device, we check that,
+            // otherwise just do a full scan if udevDevice == NULL
+            updatePluggedList(udevDevice);
+
+            if (!udevDevice)
+                break;
 
-        if (udevDevice)
             udev_device_unref(udevDevice);
+        }
     }
 
     if (index >= joystickList.size())
@@ -603,6 +617,24 @@ bool JoystickImpl::isConnected(unsigned int index)
     return joystickList[index].plugged;
 }
 
+
+////////////////////////////////////////////////////////////
+bool JoystickImpl::getWaitDescriptors(std::vector<int>& descriptors)
+{
+    descriptors.insert(descriptors.end(), openFiles.begin(), openFiles.end());
+
+    // Without a udev monitor, connections are only detected by scanning
+    if (!udevMonitor)
+        return false;
+
+    // When all the slots are used, monitor events are not consumed anymore,
+    // and a device can only be disconnected, which its own descriptor reports
+    if (openFiles.size() < Joystick::Count)
+        descriptors.push_back(udev_monitor_get_fd(udevMonitor));
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////
 bool JoystickImpl::open(unsigned int index)
 {
@@ -617,9 +649,14 @@ bool JoystickImpl::open(unsigned int index)
         m_file = ::open(devnode.c_str(), O_RDONLY | O_NONBLOCK);
         if (m_file >= 0)
         {
+            openFiles.push_back(m_file);
+
             // Retrieve the axes mapping
             ioctl(m_file, JSIOCGAXMAP, m_mapping);
 
+            // The capabilities of a device never change while it is open
+            m_capabilities = queryCapabilities();
+
             // Get info
             m_identification.name = getJoystickName(index);
 
@@ -647,13 +684,64 @@ bool JoystickImpl::open(unsigned int index)
 ////////////////////////////////////////////////////////////
 void JoystickImpl::close()
 {
+    openFiles.erase(std::remove(openFiles.begin(), openFiles.end(), m_file), openFiles.end());
+
     ::close(m_file);
     m_file = -1;
+    m_capabilities = JoystickCaps();
 }
 
 
 ////////////////////////////////////////////////////////////
 JoystickCaps JoystickImpl::getCapabilities() const
+{
+    return m_capabilities;
+}
+
+
+////////////////////////////////////////////////////////////
+Joystick::Identification JoystickImpl::getIdentification() const
+{
+    return m_identification;
+}
+
+
+////////////////////////////////////////////////////////////
+JoystickState JoystickImpl::JoystickImpl::update()
+{
+    if (m_file < 0)
+    {
+        m_state = JoystickState();
+        return m_state;
+    }
+
+    // Pop events from the joystick file, several at a time; a short read
+    // means that the driver has no more events for us
+    js_event events[32];
+    ssize_t result = 0;
+    do
+    {
+        result = read(m_file, events, sizeof(events));
+
+        for (ssize_t i = 0; i < result / static_cast<ssize_t>(sizeof(js_event)); ++i)
+            processEvent(events[i]);
+    }
+    while (result == static_cast<ssize_t>(sizeof(events)));
+
+    // Check the connection state of the joystick
+    // read() returns -1 and errno != EGAIN if it's no longer connected
+    // We need to check the result of read() as well, since errno could
+    // have been previously set by some other function call that failed
+    // If result is not negative, assume the joystick is still connected
+    // If result is negative, check errno and disconnect if it is not EAGAIN
+    m_state.connected = ((result >= 0) || (errno == EAGAIN));
+
+    return m_state;
+}
+
+
+////////////////////////////////////////////////////////////
+JoystickCaps JoystickImpl::queryCapabilities() const
 {
     JoystickCaps caps;
 
@@ -693,77 +781,46 @@ JoystickCaps JoystickImpl::getCapabilities() const
 
 
 ////////////////////////////////////////////////////////////
-Joystick::Identification JoystickImpl::getIdentification() const
+void JoystickImpl::processEvent(const js_event& event)
 {
-    return m_identification;
-}
-
-
-////////////////////////////////////////////////////////////
-JoystickState JoystickImpl::JoystickImpl::update()
-{
-    if (m_file < 0)
-    {
-        m_state = JoystickState();
-        return m_state;
-    }
-
-    // pop events from the joystick file
-    js_event joyState;
-    int result = read(m_file, &joyState, sizeof(joyState));
-    while (result > 0)
+    switch (event.type & ~JS_EVENT_INIT)
     {
-        switch (joyState.type & ~JS_EVENT_INIT)
+        // An axis was moved
+        case JS_EVENT_AXIS:
         {
-            // An axis was moved
-            case JS_EVENT_AXIS:
-            {
-                float value = joyState.value * 100.f / 32767.f;
+            float value = event.value * 100.f / 32767.f;
 
-                if (joyState.number < ABS_MAX + 1)
+            if (event.number < ABS_MAX + 1)
+            {
+                switch (m_mapping[event.number])
                 {
-                    switch (m_mapping[joyState.number])
-                    {
-                        case ABS_X:        m_state.axes[Joystick::X]    = value; break;
-                        case ABS_Y:        m_state.axes[Joystick::Y]    = value; break;
-                        case ABS_Z:
-                        case ABS_THROTTLE: m_state.axes[Joystick::Z]    = value; break;
-                        case ABS_RZ:
-                        case ABS_RUDDER:   m_state.axes[Joystick::R]    = value; break;
-                        case ABS_RX:       m_state.axes[Joystick::U]    = value; break;
-                        case ABS_RY:       m_state.axes[Joystick::V]    = value; break;
-                        case ABS_HAT0X:    m_state.axes[Joystick::PovX] = value; break;
-                        case ABS_HAT0Y:    m_state.axes[Joystick::PovY] = value; break;
-                        default:           break;
-                    }
+                    case ABS_X:        m_state.axes[Joystick::X]    = value; break;
+                    case ABS_Y:        m_state.axes[Joystick::Y]    = value; break;
+                    case ABS_Z:
+                    case ABS_THROTTLE: m_state.axes[Joystick::Z]    = value; break;
+                    case ABS_RZ:
+                    case ABS_RUDDER:   m_state.axes[Joystick::R]    = value; break;
+                    case ABS_RX:       m_state.axes[Joystick::U]    = value; break;
+                    case ABS_RY:       m_state.axes[Joystick::V]    = value; break;
+                    case ABS_HAT0X:    m_state.axes[Joystick::PovX] = value; break;
+                    case ABS_HAT0Y:    m_state.axes[Joystick::PovY] = value; break;
+                    default:           break;
                 }
-                break;
-            }
-
-            // A button was pressed
-            case JS_EVENT_BUTTON:
-            {
-                if (joyState.number < Joystick::ButtonCount)
-                    m_state.buttons[joyState.number] = (joyState.value != 0);
-                break;
             }
+            break;
         }
 
-        result = read(m_file, &joyState, sizeof(joyState));
+        // A button was pressed
+        case JS_EVENT_BUTTON:
+        {
+            if (event.number < Joystick::ButtonCount)
+                m_state.buttons[event.number] = (event.value != 0);
+            break;
+        }
     }
-
-    // Check the connection state of the joystick
-    // read() returns -1 and errno != EGAIN if it's no longer connected
-    // We need to check the result of read() as well, since errno could
-    // have been previously set by some other function call that failed
-    // result can be either negative or 0 at this point
-    // If result is 0, assume the joystick is still connected
-    // If result is negative, check errno and disconnect if it is not EAGAIN
-    m_state.connected = (!result || (errno == EAGAIN));
-
-    return m_state;
 }
 
+
 } // namespace priv
 
 } // namespace sf
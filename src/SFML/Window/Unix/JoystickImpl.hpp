@@ -30,7 +30,9 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/JoystickImpl.hpp>
 #include <linux/input.h>
+#include <vector>
 
+struct js_event;
 
 namespace sf
 {
@@ -72,6 +74,22 @@ public:
     ////////////////////////////////////////////////////////////
     static bool isConnected(unsigned int index);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the file descriptors to wait on for joystick events
+    ///
+    /// The descriptors become readable when a joystick is
+    /// connected or disconnected, or when the state of an open
+    /// joystick changes.
+    ///
+    /// \param descriptors Vector to append the descriptors to
+    ///
+    /// \return True if waiting on the descriptors is enough to be
+    ///         notified of all the joystick changes, false if the
+    ///         joysticks must also be checked periodically
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool getWaitDescriptors(std::vector<int>& descriptors);
+
     ////////////////////////////////////////////////////////////
     /// \brief Open the joystick
     ///
@@ -114,11 +132,28 @@ public:
 
 private:
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Query the capabilities of the open device
+    ///
+    /// \return Joystick capabilities
+    ///
+    ////////////////////////////////////////////////////////////
+    JoystickCaps queryCapabilities() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply an event read from the device to the state
+    ///
+    /// \param event Event to apply
+    ///
+    ////////////////////////////////////////////////////////////
+    void processEvent(const js_event& event);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     int                          m_file;                 ///< File descriptor of the joystick
     char                         m_mapping[ABS_MAX + 1]; ///< Axes mapping (index to axis id)
+    JoystickCaps                 m_capabilities;         ///< Capabilities of the joystick, cached when it is opened
     JoystickState                m_state;                ///< Current state of the joystick
     sf::Joystick::Identification m_identification;       ///< Identification of the joystick
 };
@@ -44,6 +44,8 @@
 #include <unistd.h>
 #include <libgen.h>
 #include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
 #include <algorithm>
 #include <vector>
 #include <string>
@@ -839,6 +841,58 @@ void WindowImplX11::processEvents()
 }
 
 
+////////////////////////////////////////////////////////////
+void WindowImplX11::waitForEvents()
+{
+    // Events for this window may already have been read from the connection
+    // while processing the previous ones; they won't wake poll up
+    XEvent event;
+    if (XCheckIfEvent(m_display, &event, &checkEvent, reinterpret_cast<XPointer>(m_window)))
+    {
+        XPutBackEvent(m_display, &event);
+        return;
+    }
+
+    // Make sure that our requests reach the server before waiting for its answers
+    XFlush(m_display);
+
+    std::vector<pollfd> descriptors(1);
+    descriptors[0].fd = ConnectionNumber(m_display);
+    descriptors[0].events = POLLIN;
+    descriptors[0].revents = 0;
+
+    // The display connection is shared with other windows and threads, which
+    // may read our events from it; the timeout bounds the delay in that case
+    int timeout = 100;
+
+#if defined(SFML_SYSTEM_LINUX)
+
+    std::vector<int> joystickDescriptors;
+    if (!JoystickImpl::getWaitDescriptors(joystickDescriptors))
+        timeout = 10;
+
+    for (std::vector<int>::const_iterator it = joystickDescriptors.begin(); it != joystickDescriptors.end(); ++it)
+    {
+        pollfd descriptor;
+        descriptor.fd = *it;
+        descriptor.events = POLLIN;
+        descriptor.revents = 0;
+        descriptors.push_back(descriptor);
+    }
+
+#else
+
+    // Joysticks can only be polled
+    timeout = 10;
+
+#endif
+
+    while ((poll(&descriptors[0], descriptors.size(), timeout) < 0) && (errno == EINTR))
+    {
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2i WindowImplX11::getPosition() const
 {
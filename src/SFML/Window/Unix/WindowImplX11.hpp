@@ -202,6 +202,15 @@ protected:
     ////////////////////////////////////////////////////////////
     virtual void processEvents();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until new events may be available
+    ///
+    /// Blocks on the connection to the X server and, on Linux,
+    /// on the joystick devices.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void waitForEvents();
+
 private:
 
     ////////////////////////////////////////////////////////////
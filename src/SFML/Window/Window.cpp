@@ -28,7 +28,6 @@
 #include <SFML/Window/Window.hpp>
 #include <SFML/Window/GlContext.hpp>
 #include <SFML/Window/WindowImpl.hpp>
-#include <SFML/System/Sleep.hpp>
 #include <SFML/System/Err.hpp>
 
 
@@ -44,7 +43,6 @@ namespace sf
 Window::Window() :
 m_impl          (NULL),
 m_context       (NULL),
-m_frameTimeLimit(Time::Zero),
 m_size          (0, 0)
 {
 
@@ -55,7 +53,6 @@ m_size          (0, 0)
 Window::Window(VideoMode mode, const String& title, Uint32 style, const ContextSettings& settings) :
 m_impl          (NULL),
 m_context       (NULL),
-m_frameTimeLimit(Time::Zero),
 m_size          (0, 0)
 {
     create(mode, title, style, settings);
@@ -66,7 +63,6 @@ m_size          (0, 0)
 Window::Window(WindowHandle handle, const ContextSettings& settings) :
 m_impl          (NULL),
 m_context       (NULL),
-m_frameTimeLimit(Time::Zero),
 m_size          (0, 0)
 {
     create(handle, settings);
@@ -323,9 +319,16 @@ void Window::setKeyRepeatEnabled(bool enabled)
 void Window::setFramerateLimit(unsigned int limit)
 {
     if (limit > 0)
-        m_frameTimeLimit = seconds(1.f / limit);
+        m_framePacer.setFrameTime(seconds(1.f / limit));
     else
-        m_frameTimeLimit = Time::Zero;
+        m_framePacer.setFrameTime(Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+const FramePacer& Window::getFramePacer() const
+{
+    return m_framePacer;
 }
 
 
@@ -383,11 +386,7 @@ void Window::display()
         m_context->display();
 
     // Limit the framerate if needed
-    if (m_frameTimeLimit != Time::Zero)
-    {
-        sleep(m_frameTimeLimit - m_clock.getElapsedTime());
-        m_clock.restart();
-    }
+    m_framePacer.wait();
 }
 
 
@@ -452,7 +451,7 @@ void Window::initialize()
     m_size = m_impl->getSize();
 
     // Reset frame time
-    m_clock.restart();
+    m_framePacer.resetStatistics();
 
     // Activate the window
     setActive();
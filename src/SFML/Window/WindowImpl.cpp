@@ -115,7 +115,7 @@ void WindowImpl::setJoystickThreshold(float threshold)
 bool WindowImpl::popEvent(Event& event, bool block)
 {
     // If the event queue is empty, let's first check if new events are available from the OS
-    if (m_events.empty())
+    if (m_events.isEmpty())
     {
         // Get events from the system
         processJoystickEvents();
@@ -125,12 +125,12 @@ bool WindowImpl::popEvent(Event& event, bool block)
         // In blocking mode, we must process events until one is triggered
         if (block)
         {
-            // Here we use a manual wait loop instead of the optimized
-            // wait-event provided by the OS, so that we don't skip joystick
-            // events (which require polling)
-            while (m_events.empty())
+            // Joysticks and sensors are not event sources on every system,
+            // so we wait for whatever the implementation can wait for and
+            // then check all the sources again
+            while (m_events.isEmpty())
             {
-                sleep(milliseconds(10));
+                waitForEvents();
                 processJoystickEvents();
                 processSensorEvents();
                 processEvents();
@@ -139,15 +139,7 @@ bool WindowImpl::popEvent(Event& event, bool block)
     }
 
     // Pop the first event of the queue, if it is not empty
-    if (!m_events.empty())
-    {
-        event = m_events.front();
-        m_events.pop();
-
-        return true;
-    }
-
-    return false;
+    return m_events.pop(event);
 }
 
 
@@ -158,6 +150,13 @@ void WindowImpl::pushEvent(const Event& event)
 }
 
 
+////////////////////////////////////////////////////////////
+void WindowImpl::waitForEvents()
+{
+    sleep(milliseconds(10));
+}
+
+
 ////////////////////////////////////////////////////////////
 void WindowImpl::processJoystickEvents()
 {
@@ -169,7 +168,7 @@ void WindowImpl::processJoystickEvents()
         // Copy the previous state of the joystick and get the new one
         JoystickState previousState = m_joystickStates[i];
         m_joystickStates[i] = JoystickManager::getInstance().getState(i);
-        JoystickCaps caps = JoystickManager::getInstance().getCapabilities(i);
+        const JoystickCaps& caps = JoystickManager::getInstance().getCapabilities(i);
 
         // Connection state
         bool connected = m_joystickStates[i].connected;
@@ -34,6 +34,7 @@
 #include <SFML/Window/ContextSettings.hpp>
 #include <SFML/Window/CursorImpl.hpp>
 #include <SFML/Window/Event.hpp>
+#include <SFML/Window/EventQueue.hpp>
 #include <SFML/Window/Joystick.hpp>
 #include <SFML/Window/JoystickImpl.hpp>
 #include <SFML/Window/Sensor.hpp>
@@ -41,7 +42,6 @@
 #include <SFML/Window/VideoMode.hpp>
 #include <SFML/Window/WindowHandle.hpp>
 #include <SFML/Window/Window.hpp>
-#include <queue>
 #include <set>
 
 namespace sf
@@ -260,6 +260,19 @@ protected:
     ////////////////////////////////////////////////////////////
     virtual void processEvents() = 0;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until new events may be available
+    ///
+    /// This function is called by popEvent in blocking mode,
+    /// between two rounds of event processing. It may return
+    /// early, even if no event is available. The default
+    /// implementation sleeps for a short time; derived classes
+    /// can override it to block on the event sources of the
+    /// operating system instead.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void waitForEvents();
+
 private:
 
     ////////////////////////////////////////////////////////////
@@ -277,7 +290,7 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::queue<Event> m_events;                                              ///< Queue of available events
+    EventQueue        m_events;                                              ///< Queue of available events
     JoystickState     m_joystickStates[Joystick::Count];                     ///< Previous state of the joysticks
     Vector3f          m_sensorValue[Sensor::Count];                          ///< Previous value of the sensors
     float             m_joystickThreshold;                                   ///< Joystick threshold (minimum motion for "move" event to be generated)